@@ -8,22 +8,300 @@
 ********************************************************************************************/
 
 #include "raylib.h"
+#define LAUNCHER_HOOKS_TYPES_ONLY
+#include "launcher_hooks.h"     // Frame timings ring shared with launched examples
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/wait.h>
+#include <dirent.h>
+#include <ctype.h>
+#include <limits.h>
+#include <sys/resource.h>
+#include <sys/mman.h>
+#include <math.h>
 
-#define MAX_EXAMPLES 200
 #define MAX_NAME_LENGTH 128
 #define TAB_COUNT 8
 
+// Compiled example binaries are stored here, one file per content hash
+#define CACHE_DIR "/tmp/raylib_launcher_cache"
+#define COMPILER "gcc"
+#define MAX_BUILD_WORKERS 32
+
+// Launch log panel, a ring buffer of the last output lines of compiler and examples
+#define LOG_MAX_LINES 512
+#define LOG_LINE_LENGTH 256
+#define LOG_PANEL_HEIGHT 200
+
+// Source search, trigram index over raylib-examples/*/*.c cached on disk
+#define SEARCH_CACHE_PATH CACHE_DIR "/search_index.bin"
+#define SEARCH_CACHE_VERSION 1
+#define MAX_SEARCH_QUERY 64
+#define MAX_SEARCH_RESULTS 64
+#define SEARCH_RESULT_LINES 2
+
+// Headless frame-time benchmark, examples are built with the frame hooks force-included
+#define HOOKS_HEADER "launcher_hooks.h"
+#define BENCH_DEFAULT_FRAMES 300
+#define BENCH_DEFAULT_TIMEOUT 60
+
+// Warm launching, examples are handed to helper processes started ahead of time
+#define HELPER_SOURCE "launcher_helper.c"
+#define WARM_POOL_SIZE 2
+#define WARM_EXAMPLE_FLAGS "-shared -fPIC -Dmain=LauncherExampleMain"
+#define REPORT_FD 3                         // Descriptor of the first frame report in launched examples
+
+// Resource monitor of the example running from the launcher
+#define MONITOR_FD 4                        // Descriptor of the frame timings ring in launched examples
+#define MONITOR_SAMPLE_INTERVAL 0.25        // /proc sampling period (s)
+#define MONITOR_HISTORY 120                 // Samples shown by the sparklines (30 s)
+#define MONITOR_FRAME_HISTORY 240           // Frames shown by the frame time sparkline
+#define MONITOR_HISTOGRAM_BINS 1000         // Frame time histogram for the p95, 0.1 ms bins
+
+// Benchmark history, every run is stored by git revision and build configuration
+#define BENCH_HISTORY_DIR "bench_history"
+#define BENCH_REGRESSION_REPORT BENCH_HISTORY_DIR "/regressions.txt"
+#define BENCH_MAX_SAMPLES 1000              // Frame times stored per example and run
+#define BENCH_MAX_BASELINE_RUNS 5           // Baseline runs used to estimate startup noise
+#define BENCH_DEFAULT_THRESHOLD 0.10        // Relative slowdown reported as regression
+#define BENCH_SIGNIFICANCE 0.01             // Mann-Whitney p-value below which a slowdown is not noise
+
+// Thumbnail grid, screenshots are downscaled into a shared atlas texture
+#define THUMB_WIDTH 192
+#define THUMB_HEIGHT 108
+#define THUMB_ATLAS_WIDTH 2048
+#define THUMB_ATLAS_HEIGHT 1024
+#define THUMB_ATLAS_COLUMNS (THUMB_ATLAS_WIDTH/THUMB_WIDTH)
+#define THUMB_ATLAS_SLOTS (THUMB_ATLAS_COLUMNS*(THUMB_ATLAS_HEIGHT/THUMB_HEIGHT))
+#define THUMB_PREFETCH_ROWS 2               // Rows loaded above and below the visible ones
+#define THUMB_UPLOADS_PER_FRAME 4           // Atlas uploads per frame, keeps scrolling smooth
+#define GRID_CELL_WIDTH 208
+#define GRID_CELL_HEIGHT 140
+
+// Idle rendering, frames are only drawn when something changed
+#define IDLE_POLL_INTERVAL 0.025            // Input polling period while idle (s)
+#define IDLE_REFRESH_INTERVAL 1.0           // Redraw at least this often, keeps the stats and the window content fresh
+
+// Source viewer
+#define VIEWER_FONT_SIZE 16
+#define VIEWER_LINE_HEIGHT 20
+#define VIEWER_TAB_SPACES 4
+#define VIEWER_MAX_LINE_LENGTH 512          // Characters tokenized and drawn per line
+
+#if defined(__APPLE__)
+    #define PLATFORM_LIBS "-framework OpenGL -framework Cocoa -framework IOKit"
+    #define HELPER_LIBS ""
+#else
+    #define PLATFORM_LIBS "-lGL -lm -lpthread -ldl -lrt -lX11"
+    #define HELPER_LIBS "-ldl"
+#endif
+
+// Background build state of an example
+typedef enum {
+    BUILD_NONE = 0,
+    BUILD_QUEUED,
+    BUILD_RUNNING,
+    BUILD_READY,
+    BUILD_FAILED
+} BuildState;
+
+// Resources used by the last run of an example
+typedef struct {
+    bool valid;
+    int frames;             // Frames reported by launcher_hooks.h
+    float frameAverage;     // Frame time (ms)
+    float frameP95;
+    float workAverage;      // Update and draw time, without buffer swap and frame pacing (ms)
+    float cpuAverage;       // CPU use over the run (%), all threads
+    float peakRss;          // Peak resident set size (MB)
+    int peakThreads;
+} ResourceSummary;
+
 typedef struct {
     char name[MAX_NAME_LENGTH];
     char category[32];
     char filepath[256];
     char difficulty[16];
+    int categoryId;         // Tab index of the category, resolved once at load time
+    int tabPosition;        // Position of the example inside its category tab
+    bool lastLaunchCached;  // Last launch reused a cached binary
+    bool regressed;         // Flagged by the last benchmark regression report
+    char regressionText[160];
+    BuildState buildState;  // Protected by buildMutex
+    double compileTime;     // Wall-clock time of the last compilation (ms), 0 if cached
+    double runTime;         // Wall-clock time of the last run (s)
+    int exitStatus;         // waitpid() status of the last run, -1 if never run
+    double firstFrameTime;  // Start of the last run to the end of its first frame (ms), 0 if unknown
+    bool lastLaunchWarm;    // Last run was handed to a warm helper
+    bool warmUnsupported;   // Protected by buildMutex, shared object build fails for this example only
+    ResourceSummary resources;
 } ExampleInfo;
 
+// Launch stage of the example running from the launcher
+typedef enum {
+    LAUNCH_IDLE = 0,
+    LAUNCH_COMPILING,
+    LAUNCH_RUNNING
+} LaunchStage;
+
+// Child process with its output pipes, never waited on in blocking mode
+typedef struct {
+    pid_t pid;
+    int outFd;
+    int errFd;
+    int reportFd;                       // First frame report of an example, -1 if none
+    LauncherMonitorRing* monitor;       // Frame timings of an example, NULL if none
+    struct rusage usage;                // Resources used, filled once it exited
+    char outPartial[LOG_LINE_LENGTH];   // Output received without its newline yet
+    char errPartial[LOG_LINE_LENGTH];
+    int outPartialLength;
+    int errPartialLength;
+} ChildProcess;
+
+// Helper process started ahead of time, waiting for an example to run
+typedef struct {
+    ChildProcess process;
+    int commandFd;                      // Helper stdin, receives the example to run
+} WarmHelper;
+
+// Live resource use of the example running from the launcher
+typedef struct {
+    double sampleTime;                  // Time of the last /proc sample
+    double startCpuTime;                // Process CPU time when the run started (s)...
+    double cpuTime;                     // ...and at the last sample
+    float cpu[MONITOR_HISTORY];         // CPU use (%), all threads
+    float rss[MONITOR_HISTORY];         // Resident set size (MB)
+    float threads[MONITOR_HISTORY];
+    int sampleHead;                     // Next sample to write
+    int sampleCount;
+    float frameTimes[MONITOR_FRAME_HISTORY];
+    float workTimes[MONITOR_FRAME_HISTORY];     // Update and draw part of the frame time
+    int frameHead;
+    int frameCount;
+    unsigned int frameRead;             // Frames of the ring already read
+    int histogram[MONITOR_HISTOGRAM_BINS];
+    int frameTotal;
+    double frameSum;
+    double workSum;
+    float peakRss;
+    int peakThreads;
+} ResourceMonitor;
+
+typedef struct {
+    char text[LOG_LINE_LENGTH];
+    Color color;
+} LogLine;
+
+// Syntax class of a source token
+typedef enum {
+    TOKEN_PLAIN = 0,
+    TOKEN_KEYWORD,
+    TOKEN_TYPE,
+    TOKEN_FUNCTION,
+    TOKEN_PREPROCESSOR,
+    TOKEN_COMMENT,
+    TOKEN_STRING,
+    TOKEN_NUMBER
+} TokenKind;
+
+typedef struct {
+    short start;            // Offset inside the line
+    short length;
+    short x;                // Position from the line start (px)
+    unsigned char kind;
+} SourceToken;
+
+// Tokens of a source line, built the first time the line is shown
+typedef struct {
+    SourceToken* tokens;    // NULL until tokenized
+    int tokenCount;
+} SourceLine;
+
+// Thumbnail state of an example, screenshots are decoded on the loader thread and uploaded on the main one
+typedef enum {
+    THUMB_NONE = 0,
+    THUMB_QUEUED,
+    THUMB_DECODING,
+    THUMB_DECODED,          // Downscaled image waiting for an atlas slot
+    THUMB_RESIDENT,         // In the atlas
+    THUMB_MISSING           // No screenshot, or it could not be decoded
+} ThumbState;
+
+typedef struct {
+    ThumbState state;       // Protected by thumbMutex
+    Image image;            // THUMB_DECODED only
+    int slot;               // Atlas slot, THUMB_RESIDENT only
+    int width;              // Size of the thumbnail inside its slot
+    int height;
+    bool wanted;            // Part of the last request, visible or prefetched
+} Thumbnail;
+
+// Source file covered by the search index
+typedef struct {
+    char path[256];
+    long long mtime;
+    long long size;
+    int exampleIndex;       // Example of the catalog built from this file, -1 if none
+    char* text;             // Original source, for the matching lines display
+    char* lower;            // Lowercase copy, used for matching
+    bool textLoaded;        // Text was read, it stays NULL if the file could not be opened
+} SearchFile;
+
+// Benchmark command line options
+typedef struct {
+    int frames;                 // Frames to run every example
+    double timeout;             // Seconds before an example is killed
+    const char* outputPath;     // .csv or .json
+    const char* inputPath;      // Automation events to replay, NULL for no input
+    const char* filter;         // Only examples whose name contains it, NULL for all
+    bool softwareGL;            // Force Mesa llvmpipe
+    bool xvfb;                  // Run examples on a private Xvfb display
+    const char* baselineRev;    // Compare against this git revision, NULL for the previous run
+    double threshold;           // Relative slowdown reported as regression
+} BenchOptions;
+
+// Benchmark results of an example
+typedef struct {
+    int exampleIndex;
+    bool completed;             // Ran all frames and wrote its frame times
+    char status[64];
+    int frameCount;
+    float* frameTimes;          // Frame times (ms), the first frame is not included
+    double p50, p95, p99, max;  // Frame time percentiles (ms)
+    double startupTime;         // Process start to end of the first frame (ms)
+    long peakRss;               // Peak resident set size (KB)
+} BenchResult;
+
+// Stored benchmark run, loaded from the history
+typedef struct {
+    char path[512];
+    char rev[64];
+    uint64_t config;
+    long long timestamp;
+    int resultCount;
+    BenchResult* results;
+    char (*names)[MAX_NAME_LENGTH];     // Example name of every result
+} BenchRun;
+
+// Search result, a file with the first matching lines
+typedef struct {
+    int fileIndex;
+    int matchCount;
+    int score;
+    int lineCount;
+    int lineNumbers[SEARCH_RESULT_LINES];
+    int lineOffsets[SEARCH_RESULT_LINES];
+} SearchResult;
+
 typedef struct {
     char name[32];
     Color color;
@@ -31,8 +309,10 @@ typedef struct {
 } TabInfo;
 
 // Global variables
-ExampleInfo examples[MAX_EXAMPLES];
+ExampleInfo* examples = NULL;       // Grows as needed, catalogs can be much larger than the official list
 int exampleCount = 0;
+int exampleCapacity = 0;
+int* tabExamples[TAB_COUNT] = { 0 };   // Per tab list of example indices, in display order
 int selectedExample = 0;
 int scrollOffset = 0;
 int maxVisibleItems = 20;
@@ -52,285 +332,3503 @@ TabInfo tabs[TAB_COUNT] = {
     {"Audio", PINK, 0}
 };
 
-// Category colors
-Color GetCategoryColor(const char* category) {
-    if (strcmp(category, "core") == 0) return SKYBLUE;
-    if (strcmp(category, "shapes") == 0) return RED;
-    if (strcmp(category, "textures") == 0) return GREEN;
-    if (strcmp(category, "text") == 0) return GOLD;
-    if (strcmp(category, "models") == 0) return PURPLE;
-    if (strcmp(category, "shaders") == 0) return ORANGE;
-    if (strcmp(category, "audio") == 0) return PINK;
-    return GRAY;
+// Compile cache
+char compileFlags[512] = { 0 };     // Resolved once at startup, part of every cache key
+int cacheHits = 0;
+int cacheMisses = 0;
+double lastLaunchTime = 0;          // Time from ENTER to process start of the last launch (ms)
+
+// Background precompilation pool
+pthread_t buildWorkers[MAX_BUILD_WORKERS];
+pthread_mutex_t buildMutex = PTHREAD_MUTEX_INITIALIZER;
+int buildWorkerCount = 0;
+bool buildPoolRunning = false;
+bool buildPoolStop = false;         // Protected by buildMutex
+int buildWorkersActive = 0;         // Protected by buildMutex, workers not finished yet
+int buildFocusTab = 0;              // Protected by buildMutex, builds start with this tab...
+int buildFocusIndex = 0;            // ...and the rows closest to this example
+int buildTempCounter = 0;           // Protected by buildMutex, keeps temporary output names unique
+
+// Example launch in progress
+LaunchStage launchStage = LAUNCH_IDLE;
+int launchIndex = -1;
+ChildProcess launchProcess = { 0 };
+char launchBinaryPath[512] = { 0 };
+double launchStageStartTime = 0;
+bool launchWarm = false;            // Launch built as a shared object, for a warm helper
+bool launchFallback = false;        // Regular build after the shared object one failed
+int launchWarmLogStart = 0;         // Log lines written before the shared object build started
+double launchRunStartTime = 0;      // Monotonic time the example was started or handed over
+bool launchFirstFrameSeen = false;
+
+// Warm launching
+bool warmLaunchEnabled = false;     // Protected by buildMutex, selects the build variant
+char hooksFlags[PATH_MAX + 16] = { 0 };     // Force-include of launcher_hooks.h, for the first frame report
+char warmFlags[PATH_MAX + 64] = { 0 };
+char helperPath[512] = { 0 };
+WarmHelper warmHelpers[WARM_POOL_SIZE];
+int warmHelperCount = 0;
+
+// Resource monitor of the running example
+ResourceMonitor resourceMonitor = { 0 };
+
+// Idle rendering
+bool idleRendering = true;
+pthread_mutex_t redrawMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t redrawCondition = PTHREAD_COND_INITIALIZER;
+unsigned int redrawRequests = 0;    // Protected by redrawMutex, bumped by every change to show
+unsigned int redrawHandled = 0;     // Requests shown by the last drawn frame
+double lastRedrawTime = 0;
+double cpuSampleTime = 0;           // Start of the current CPU use sample...
+double cpuSampleUsage = 0;          // ...and the process CPU time at that point (s)
+int cpuSampleFrames = 0;
+double cpuUsage = 0;                // Launcher CPU use over the last sample (%), all threads
+double drawnFps = 0;                // Frames actually drawn per second
+
+// Log panel
+LogLine logLines[LOG_MAX_LINES];
+int logHead = 0;                    // Next line to write
+int logCount = 0;
+int logTotal = 0;                   // Lines written since startup, including the overwritten ones
+int logScroll = 0;                  // Lines scrolled up from the newest one
+bool logPanelVisible = false;
+
+// Thumbnail grid view
+bool gridView = false;
+int gridColumns = 1;
+Thumbnail* thumbnails = NULL;       // One per example, allocated when the grid is first shown
+Texture2D thumbAtlas = { 0 };
+int thumbSlotOwner[THUMB_ATLAS_SLOTS];          // Example in every atlas slot, -1 if free
+unsigned int thumbSlotLastUsed[THUMB_ATLAS_SLOTS];
+unsigned int thumbFrame = 0;
+int* thumbWanted = NULL;            // Last request, in priority order
+int thumbWantedCount = 0;
+int* thumbQueue = NULL;             // Protected by thumbMutex, examples to decode...
+int thumbQueueHead = 0;             // ...from this position
+int thumbQueueCount = 0;
+bool thumbLoaderRunning = false;
+bool thumbLoaderStop = false;       // Protected by thumbMutex
+pthread_t thumbLoader;
+pthread_mutex_t thumbMutex = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t thumbCondition = PTHREAD_COND_INITIALIZER;
+
+// Source viewer, the file is mapped and only the shown lines are tokenized
+bool viewerActive = false;
+char viewerPath[256] = { 0 };
+const char* viewerData = NULL;
+size_t viewerSize = 0;
+int* viewerLineOffsets = NULL;      // Start of every line, viewerLineCount + 1 entries
+int viewerLineCount = 0;
+SourceLine* viewerLines = NULL;
+bool* viewerInComment = NULL;       // Line starts inside a block comment
+int viewerTokenizedCount = 0;
+int viewerScroll = 0;               // First visible line
+int viewerScrollX = 0;              // Horizontal scroll (px)
+int viewerVisibleLines = 1;
+char viewerParentPath[256] = { 0 };  // File the shown one was opened from as an include, empty if none
+int viewerParentScroll = 0;
+
+// Benchmark regressions view
+bool regressionView = false;
+int regressionCount = 0;
+int* regressionExamples = NULL;         // Indexes of the flagged examples, the list of the regressions view
+char regressionBaseline[128] = { 0 };   // Revisions compared by the report
+
+// Source search
+SearchFile* searchFiles = NULL;
+int searchFileCount = 0;
+uint32_t* searchKeys = NULL;        // Sorted trigrams...
+int* searchOffsets = NULL;          // ...with the range of their postings (searchKeyCount + 1 entries)...
+int* searchPostings = NULL;         // ...listing the files containing them, sorted by file index
+int searchKeyCount = 0;
+int searchPostingCount = 0;
+bool searchIndexFromCache = false;
+double searchIndexTime = 0;         // Time to build or load the index (ms)
+
+bool searchActive = false;
+char searchQuery[MAX_SEARCH_QUERY] = { 0 };
+int searchQueryLength = 0;
+SearchResult searchResults[MAX_SEARCH_RESULTS];
+int searchResultCount = 0;
+int searchTotalMatches = 0;         // Files matching, even past MAX_SEARCH_RESULTS
+int searchSelected = 0;
+int searchScroll = 0;
+double searchTime = 0;              // Time of the last query (ms)
+
+// Ask the main loop to draw a new frame, safe from any thread
+void RequestRedraw() {
+    pthread_mutex_lock(&redrawMutex);
+    redrawRequests++;
+    pthread_cond_signal(&redrawCondition);
+    pthread_mutex_unlock(&redrawMutex);
+}
+
+// Wait until a redraw is requested or the timeout expires, returns true if there is a request to show
+bool WaitForRedraw(double timeout) {
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    long long nanoseconds = deadline.tv_nsec + (long long)(timeout*1e9);
+    deadline.tv_sec += nanoseconds/1000000000LL;
+    deadline.tv_nsec = nanoseconds%1000000000LL;
+
+    pthread_mutex_lock(&redrawMutex);
+    while (redrawRequests == redrawHandled) {
+        if (pthread_cond_timedwait(&redrawCondition, &redrawMutex, &deadline) == ETIMEDOUT) break;
+    }
+    bool requested = (redrawRequests != redrawHandled);
+    pthread_mutex_unlock(&redrawMutex);
+
+    return requested;
+}
+
+// Any mouse or keyboard input since the last poll
+bool HasInputActivity() {
+    Vector2 mouseDelta = GetMouseDelta();
+    if (mouseDelta.x != 0 || mouseDelta.y != 0 || GetMouseWheelMove() != 0 || IsWindowResized()) return true;
+
+    for (int button = MOUSE_BUTTON_LEFT; button <= MOUSE_BUTTON_BACK; button++) {
+        if (IsMouseButtonDown(button) || IsMouseButtonReleased(button)) return true;
+    }
+    for (int key = KEY_SPACE; key <= KEY_KB_MENU; key++) {
+        if (IsKeyPressed(key) || IsKeyDown(key) || IsKeyReleased(key)) return true;
+    }
+
+    return false;
+}
+
+// Measure the launcher CPU use and drawn frame rate, called for every drawn frame
+void UpdateCpuUsage() {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    double cpuTime = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec*1e-6 + usage.ru_stime.tv_sec + usage.ru_stime.tv_usec*1e-6;
+    double now = GetTime();
+
+    cpuSampleFrames++;
+    if (cpuSampleTime == 0) {
+        cpuSampleTime = now;
+        cpuSampleUsage = cpuTime;
+        cpuSampleFrames = 0;
+    } else if (now - cpuSampleTime >= IDLE_REFRESH_INTERVAL) {
+        cpuUsage = 100.0*(cpuTime - cpuSampleUsage)/(now - cpuSampleTime);
+        drawnFps = cpuSampleFrames/(now - cpuSampleTime);
+        cpuSampleTime = now;
+        cpuSampleUsage = cpuTime;
+        cpuSampleFrames = 0;
+    }
+}
+
+// Category colors, same as the category tab
+Color GetCategoryColor(int categoryId) {
+    if (categoryId > 0 && categoryId < TAB_COUNT) return tabs[categoryId].color;
+    return GRAY;
+}
+
+// Get tab index from category name
+int GetTabIndexFromCategory(const char* category) {
+    if (strcmp(category, "core") == 0) return 1;
+    if (strcmp(category, "shapes") == 0) return 2;
+    if (strcmp(category, "textures") == 0) return 3;
+    if (strcmp(category, "text") == 0) return 4;
+    if (strcmp(category, "models") == 0) return 5;
+    if (strcmp(category, "shaders") == 0) return 6;
+    if (strcmp(category, "audio") == 0) return 7;
+    return 0;
+}
+
+// Monotonic time in seconds, usable before the window is initialized
+double GetMonotonicTime() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+}
+
+// Append an example to the catalog, category must be one of the tab categories
+void AddExample(const char* category, const char* filename, const char* stars) {
+    if (exampleCount == exampleCapacity) {
+        int capacity = (exampleCapacity == 0) ? 256 : exampleCapacity*2;
+        ExampleInfo* grown = (ExampleInfo*)realloc(examples, capacity*sizeof(ExampleInfo));
+        if (!grown) return;
+        examples = grown;
+        exampleCapacity = capacity;
+    }
+
+    ExampleInfo* example = &examples[exampleCount];
+    memset(example, 0, sizeof(ExampleInfo));
+
+    // Store example info
+    snprintf(example->name, MAX_NAME_LENGTH, "%s", filename);
+    snprintf(example->category, 32, "%s", category);
+    snprintf(example->filepath, 256, "raylib-examples/%s/%s.c", category, filename);
+    example->categoryId = GetTabIndexFromCategory(category);
+    example->exitStatus = -1;
+
+    // Convert star symbols
+    if (strlen(stars) > 0) {
+        strncpy(example->difficulty, stars, 15);
+    } else {
+        strcpy(example->difficulty, "★☆☆☆");
+    }
+
+    // Count examples per category
+    tabs[example->categoryId].count++;
+    tabs[0].count++; // All
+
+    exampleCount++;
+}
+
+// Build the per tab index arrays, so filtering and row mapping never scan the catalog
+void BuildTabIndex() {
+    for (int tab = 1; tab < TAB_COUNT; tab++) {
+        free(tabExamples[tab]);
+        tabExamples[tab] = (int*)malloc((tabs[tab].count + 1)*sizeof(int));
+    }
+
+    int filled[TAB_COUNT] = { 0 };
+    for (int i = 0; i < exampleCount; i++) {
+        int tab = examples[i].categoryId;
+        examples[i].tabPosition = filled[tab];
+        tabExamples[tab][filled[tab]++] = i;
+    }
+}
+
+// Remove all examples from the catalog
+void ClearExamples() {
+    free(regressionExamples);
+    regressionExamples = NULL;
+    regressionCount = 0;
+    regressionView = false;
+
+    for (int tab = 0; tab < TAB_COUNT; tab++) {
+        free(tabExamples[tab]);
+        tabExamples[tab] = NULL;
+        tabs[tab].count = 0;
+    }
+
+    free(examples);
+    examples = NULL;
+    exampleCount = 0;
+    exampleCapacity = 0;
+}
+
+// Load all examples from the examples list
+void LoadExamplesList() {
+    FILE* fp = fopen("raylib-examples/examples_list.txt", "r");
+    if (!fp) {
+        printf("Could not open examples_list.txt\n");
+        return;
+    }
+
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        // Skip empty lines and comments
+        if (line[0] == '\n' || line[0] == '#') continue;
+
+        // Parse the line format: "category;example_name;stars;..."
+        char category[32] = {0};
+        char filename[128] = {0};
+        char stars[16] = {0};
+
+        // Use strtok to parse semicolon-separated values
+        char* token = strtok(line, ";");
+        if (token) {
+            strncpy(category, token, 31);
+
+            token = strtok(NULL, ";");
+            if (token) {
+                strncpy(filename, token, 127);
+
+                token = strtok(NULL, ";");
+                if (token) {
+                    strncpy(stars, token, 15);
+                }
+            }
+        }
+
+        // Skip if parsing failed or not a main category
+        if (strlen(category) == 0 || strlen(filename) == 0) continue;
+        if (GetTabIndexFromCategory(category) == 0) continue;
+
+        AddExample(category, filename, stars);
+    }
+
+    fclose(fp);
+    BuildTabIndex();
+    printf("Loaded %d examples\n", exampleCount);
+}
+
+// Get filtered example index (accounting for active tab filter)
+int GetFilteredExampleCount() {
+    if (regressionView) return regressionCount;
+    return tabs[activeTab].count;
+}
+
+// Get real index from filtered index
+int GetRealIndexFromFiltered(int filteredIndex) {
+    if (regressionView) return (filteredIndex >= 0 && filteredIndex < regressionCount) ? regressionExamples[filteredIndex] : 0;
+    if (filteredIndex < 0 || filteredIndex >= tabs[activeTab].count) return 0;
+    if (activeTab == 0) return filteredIndex;
+
+    return tabExamples[activeTab][filteredIndex];
+}
+
+// Get filtered index from real index
+int GetFilteredIndexFromReal(int realIndex) {
+    if (realIndex < 0 || realIndex >= exampleCount) return 0;
+    if (regressionView) {
+        for (int i = 0; i < regressionCount; i++) if (regressionExamples[i] == realIndex) return i;
+        return 0;
+    }
+    if (activeTab == 0) return realIndex;
+
+    return (examples[realIndex].categoryId == activeTab) ? examples[realIndex].tabPosition : 0;
+}
+
+// Get filtered row under a screen position, -1 if there is none
+int GetFilteredIndexAtPosition(Vector2 position, int screenWidth) {
+    int listY = 50 + 10;
+    int itemHeight = 40;
+
+    if (position.x < 10 || position.x >= screenWidth - 20 || position.y < listY) return -1;
+
+    if (gridView) {
+        int column = (int)(position.x - 10)/GRID_CELL_WIDTH;
+        int row = (int)(position.y - listY)/GRID_CELL_HEIGHT;
+        if (column >= gridColumns || row >= maxVisibleItems/gridColumns) return -1;
+        if ((position.x - 10) - column*GRID_CELL_WIDTH >= GRID_CELL_WIDTH - 6 || (position.y - listY) - row*GRID_CELL_HEIGHT >= GRID_CELL_HEIGHT - 6) return -1;
+
+        int filteredIndex = scrollOffset + row*gridColumns + column;
+        return (filteredIndex < GetFilteredExampleCount()) ? filteredIndex : -1;
+    }
+
+    int row = (int)(position.y - listY)/itemHeight;
+    if (row >= maxVisibleItems || (position.y - listY) - row*itemHeight >= itemHeight - 2) return -1;
+
+    int filteredIndex = scrollOffset + row;
+    return (filteredIndex < GetFilteredExampleCount()) ? filteredIndex : -1;
+}
+
+// Resolve the raylib compiler/linker flags once, so pkg-config does not run on every launch
+void ResolveCompileFlags() {
+    char pkgFlags[384] = { 0 };
+
+    FILE* pipe = popen("pkg-config --cflags --libs raylib 2>/dev/null", "r");
+    if (pipe) {
+        if (!fgets(pkgFlags, sizeof(pkgFlags), pipe)) pkgFlags[0] = '\0';
+        pclose(pipe);
+    }
+    pkgFlags[strcspn(pkgFlags, "\r\n")] = '\0';
+    if (pkgFlags[0] == '\0') strcpy(pkgFlags, "-lraylib");
+
+    snprintf(compileFlags, sizeof(compileFlags), "%s %s", pkgFlags, PLATFORM_LIBS);
+}
+
+// FNV-1a 64-bit hash, chained through hash
+uint64_t HashBytes(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+// Hash the full contents of a file, returns false if it can not be read
+bool HashFile(uint64_t* hash, const char* path) {
+    FILE* fp = fopen(path, "rb");
+    if (!fp) return false;
+
+    unsigned char buffer[16384];
+    size_t bytesRead = 0;
+    while ((bytesRead = fread(buffer, 1, sizeof(buffer), fp)) > 0) {
+        *hash = HashBytes(*hash, buffer, bytesRead);
+    }
+    fclose(fp);
+    return true;
+}
+
+// Cache key: example source + local headers it includes (raygui.h, rlights.h, reasings.h...) + compiler flags
+// NOTE: extraFlags select a build variant, headers they force-include with -include are part of the key
+uint64_t ComputeExampleHash(int index, const char* extraFlags) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = HashBytes(hash, COMPILER, strlen(COMPILER));
+    hash = HashBytes(hash, compileFlags, strlen(compileFlags));
+    if (!HashFile(&hash, examples[index].filepath)) return 0;
+
+    if (extraFlags) {
+        hash = HashBytes(hash, extraFlags, strlen(extraFlags));
+
+        const char* include = extraFlags;
+        while ((include = strstr(include, "-include ")) != NULL) {
+            include += strlen("-include ");
+            char headerPath[1024];
+            int length = (int)strcspn(include, " ");
+            snprintf(headerPath, sizeof(headerPath), "%.*s", length, include);
+            if (!HashFile(&hash, headerPath)) return 0;
+        }
+    }
+
+    FILE* fp = fopen(examples[index].filepath, "r");
+    if (!fp) return 0;
+
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        const char* start = line;
+        while (*start == ' ' || *start == '\t') start++;
+        if (strncmp(start, "#include", 8) != 0) continue;
+
+        // Only quoted includes can be local, headers not found next to the example are system ones (raymath.h, rlgl.h)
+        start = strchr(start, '"');
+        if (!start) continue;
+        const char* end = strchr(start + 1, '"');
+        if (!end) continue;
+
+        char headerPath[512];
+        snprintf(headerPath, sizeof(headerPath), "raylib-examples/%s/%.*s",
+                 examples[index].category, (int)(end - start - 1), start + 1);
+        if (HashFile(&hash, headerPath)) hash = HashBytes(hash, headerPath, strlen(headerPath));
+    }
+    fclose(fp);
+
+    return hash;
+}
+
+// Get cached binary path for an example, returns true if it is already built
+bool GetCachedBinaryPath(int index, const char* extraFlags, char* path, int size) {
+    uint64_t hash = ComputeExampleHash(index, extraFlags);
+    snprintf(path, size, CACHE_DIR "/%s-%016llx", examples[index].name, (unsigned long long)hash);
+    return (hash != 0) && (access(path, X_OK) == 0);
+}
+
+// Compile an example into its cache entry, compiler output goes to logPath or stdout when NULL
+bool BuildExample(int index, const char* extraFlags, const char* binaryPath, const char* logPath) {
+    pthread_mutex_lock(&buildMutex);
+    int tempId = buildTempCounter++;
+    pthread_mutex_unlock(&buildMutex);
+
+    mkdir(CACHE_DIR, 0755);
+
+    // Build to a unique temporary name first, so an interrupted or concurrent build never leaves a broken cache entry
+    char command[2048];
+    int commandLength = snprintf(command, sizeof(command),
+             "cd raylib-examples/%s && " COMPILER " %s %s.c -o %s.tmp%d %s %s%s%s && mv -f %s.tmp%d %s",
+             examples[index].category, extraFlags ? extraFlags : "", examples[index].name, binaryPath, tempId, compileFlags,
+             logPath ? "> " : "", logPath ? logPath : "", logPath ? " 2>&1" : "",
+             binaryPath, tempId, binaryPath);
+    if (commandLength >= (int)sizeof(command)) return false;    // Never run a cut command
+
+    return (system(command) == 0);
+}
+
+// Add a line to the log panel ring buffer, overwriting the oldest one when full
+void AddLogLine(const char* text, int length, Color color) {
+    if (length >= LOG_LINE_LENGTH) length = LOG_LINE_LENGTH - 1;
+
+    memcpy(logLines[logHead].text, text, length);
+    logLines[logHead].text[length] = '\0';
+    logLines[logHead].color = color;
+
+    logHead = (logHead + 1)%LOG_MAX_LINES;
+    logTotal++;
+    if (logCount < LOG_MAX_LINES) logCount++;
+    else if (logScroll > 0 && logScroll < LOG_MAX_LINES - 1) logScroll++;   // Keep the scrolled view in place
+
+    RequestRedraw();
+}
+
+// Add a formatted message to the log panel
+void LogMessage(Color color, const char* text) {
+    AddLogLine(text, (int)strlen(text), color);
+}
+
+// Create the frame timings ring of a launched example, returns its descriptor or -1
+// NOTE: The shared memory object is unlinked right away, it lives as long as its mappings
+int CreateMonitorRing(LauncherMonitorRing** ring) {
+    static int ringCounter = 0;
+
+    char name[64];
+    snprintf(name, sizeof(name), "/raylib_launcher_%d_%d", (int)getpid(), ringCounter++);
+
+    int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd < 0) return -1;
+    shm_unlink(name);
+
+    void* memory = MAP_FAILED;
+    if (ftruncate(fd, sizeof(LauncherMonitorRing)) == 0) {
+        memory = mmap(NULL, sizeof(LauncherMonitorRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (memory == MAP_FAILED) {
+        close(fd);
+        return -1;
+    }
+
+    // The rest of the ring is zero-filled by ftruncate()
+    *ring = (LauncherMonitorRing*)memory;
+    (*ring)->magic = LAUNCHER_MONITOR_MAGIC;
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+
+    return fd;
+}
+
+// Spawn a shell command with piped stdout and stderr, returns false if it could not be started
+// NOTE: With report, the child gets a first frame report pipe as REPORT_FD and a frame timings ring
+// as MONITOR_FD (see launcher_hooks.h), inputFd becomes its stdin when it is not -1
+bool SpawnProcess(ChildProcess* process, const char* workDir, const char* command, bool report, int inputFd) {
+    int outPipe[2], errPipe[2], reportPipe[2] = { -1, -1 };
+    if (pipe(outPipe) != 0) return false;
+    if (pipe(errPipe) != 0) {
+        close(outPipe[0]); close(outPipe[1]);
+        return false;
+    }
+    if (report && pipe(reportPipe) != 0) {
+        close(outPipe[0]); close(outPipe[1]);
+        close(errPipe[0]); close(errPipe[1]);
+        return false;
+    }
+
+    // Without a ring the example still runs, only its frame timings are missing
+    LauncherMonitorRing* monitor = NULL;
+    int monitorFd = report ? CreateMonitorRing(&monitor) : -1;
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        // Child: only async-signal-safe calls until exec
+        if (inputFd >= 0) {
+            dup2(inputFd, STDIN_FILENO);
+            if (inputFd != STDIN_FILENO) close(inputFd);
+        }
+        dup2(outPipe[1], STDOUT_FILENO);
+        dup2(errPipe[1], STDERR_FILENO);
+        close(outPipe[0]); close(outPipe[1]);
+        close(errPipe[0]); close(errPipe[1]);
+        if (report) {
+            dup2(reportPipe[1], REPORT_FD);
+            close(reportPipe[0]);
+            if (reportPipe[1] != REPORT_FD) close(reportPipe[1]);
+        }
+        if (monitorFd >= 0) {
+            dup2(monitorFd, MONITOR_FD);
+            if (monitorFd != MONITOR_FD) close(monitorFd);
+        }
+        if (workDir && chdir(workDir) != 0) _exit(127);
+        execl("/bin/sh", "sh", "-c", command, (char*)NULL);
+        _exit(127);
+    }
+
+    close(outPipe[1]);
+    close(errPipe[1]);
+    if (report) close(reportPipe[1]);
+    if (monitorFd >= 0) close(monitorFd);
+
+    if (pid < 0) {
+        close(outPipe[0]);
+        close(errPipe[0]);
+        if (report) close(reportPipe[0]);
+        if (monitor) munmap(monitor, sizeof(LauncherMonitorRing));
+        return false;
+    }
+
+    memset(process, 0, sizeof(ChildProcess));
+    process->pid = pid;
+    process->outFd = outPipe[0];
+    process->errFd = errPipe[0];
+    process->reportFd = reportPipe[0];
+    process->monitor = monitor;
+    fcntl(process->outFd, F_SETFL, fcntl(process->outFd, F_GETFL) | O_NONBLOCK);
+    fcntl(process->errFd, F_SETFL, fcntl(process->errFd, F_GETFL) | O_NONBLOCK);
+    fcntl(process->outFd, F_SETFD, FD_CLOEXEC);
+    fcntl(process->errFd, F_SETFD, FD_CLOEXEC);
+    if (report) {
+        fcntl(process->reportFd, F_SETFL, fcntl(process->reportFd, F_GETFL) | O_NONBLOCK);
+        fcntl(process->reportFd, F_SETFD, FD_CLOEXEC);
+    }
+
+    return true;
+}
+
+// Read whatever is available on a child pipe and split it into log lines, returns false once the pipe is closed
+bool ReadProcessPipe(int* fd, char* partial, int* partialLength, Color color) {
+    if (*fd < 0) return false;
+
+    char buffer[4096];
+    while (true) {
+        ssize_t bytesRead = read(*fd, buffer, sizeof(buffer));
+
+        if (bytesRead > 0) {
+            for (ssize_t i = 0; i < bytesRead; i++) {
+                if (buffer[i] == '\n' || *partialLength == LOG_LINE_LENGTH - 1) {
+                    AddLogLine(partial, *partialLength, color);
+                    *partialLength = 0;
+                    if (buffer[i] == '\n') continue;
+                }
+                if (buffer[i] != '\r') partial[(*partialLength)++] = buffer[i];
+            }
+        } else if (bytesRead < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return true;
+        } else if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        } else {
+            // End of file, flush the last unterminated line
+            if (*partialLength > 0) AddLogLine(partial, *partialLength, color);
+            *partialLength = 0;
+            close(*fd);
+            *fd = -1;
+            return false;
+        }
+    }
+}
+
+// Poll a child process without blocking, returns true once it exited and all its output was read
+bool PollProcess(ChildProcess* process, int* status) {
+    // NOTE: Reap first, so output written right before the exit is still read by the drain below
+    bool exited = false;
+    if (process->pid > 0) {
+        pid_t result = wait4(process->pid, status, WNOHANG, &process->usage);
+        if (result == process->pid || (result < 0 && errno == ECHILD)) {
+            process->pid = 0;
+            exited = true;
+        }
+    }
+
+    bool outOpen = ReadProcessPipe(&process->outFd, process->outPartial, &process->outPartialLength, LIGHTGRAY);
+    bool errOpen = ReadProcessPipe(&process->errFd, process->errPartial, &process->errPartialLength, (Color){ 255, 120, 120, 255 });
+
+    // Pipes are drained until EOF or EAGAIN after the exit, still open means a grandchild keeps them
+    if (exited && (outOpen || errOpen)) {
+        if (process->outPartialLength > 0) AddLogLine(process->outPartial, process->outPartialLength, LIGHTGRAY);
+        if (process->errPartialLength > 0) AddLogLine(process->errPartial, process->errPartialLength, (Color){ 255, 120, 120, 255 });
+        process->outPartialLength = process->errPartialLength = 0;
+
+        if (process->outFd >= 0) { close(process->outFd); process->outFd = -1; }
+        if (process->errFd >= 0) { close(process->errFd); process->errFd = -1; }
+    }
+
+    return (process->pid == 0);
+}
+
+// Close the pipes and the frame timings ring of a finished or abandoned child process
+void CloseProcessPipes(ChildProcess* process) {
+    if (process->outFd >= 0) close(process->outFd);
+    if (process->errFd >= 0) close(process->errFd);
+    if (process->reportFd >= 0) close(process->reportFd);
+    if (process->monitor) munmap(process->monitor, sizeof(LauncherMonitorRing));
+    process->outFd = process->errFd = process->reportFd = -1;
+    process->monitor = NULL;
+}
+
+// Start a warm helper, waiting on its stdin for the example to run
+bool SpawnWarmHelper(WarmHelper* helper) {
+    int commandPipe[2];
+    if (pipe(commandPipe) != 0) return false;
+
+    fcntl(commandPipe[1], F_SETFD, FD_CLOEXEC);
+
+    char command[1024];
+    snprintf(command, sizeof(command), "exec %s", helperPath);
+
+    bool started = SpawnProcess(&helper->process, NULL, command, true, commandPipe[0]);
+    close(commandPipe[0]);
+
+    if (!started) {
+        close(commandPipe[1]);
+        return false;
+    }
+
+    helper->commandFd = commandPipe[1];
+    return true;
+}
+
+// Stop a helper that was never handed an example
+void StopWarmHelper(WarmHelper* helper) {
+    close(helper->commandFd);
+    if (helper->process.pid > 0) {
+        kill(helper->process.pid, SIGTERM);
+        waitpid(helper->process.pid, NULL, 0);
+    }
+    CloseProcessPipes(&helper->process);
+}
+
+// Take a ready helper from the pool, returns false if there is none
+bool TakeWarmHelper(WarmHelper* helper) {
+    while (warmHelperCount > 0) {
+        *helper = warmHelpers[0];
+        warmHelperCount--;
+        memmove(&warmHelpers[0], &warmHelpers[1], warmHelperCount*sizeof(WarmHelper));
+
+        // A helper may have died waiting, without a display for example
+        if (waitpid(helper->process.pid, NULL, WNOHANG) == 0) return true;
+        helper->process.pid = 0;
+        StopWarmHelper(helper);
+    }
+
+    return false;
+}
+
+// Keep the pool full, one helper started per call
+// NOTE: Not while an example is starting, helpers would compete with it for the CPU
+void RefillWarmPool() {
+    if (!warmLaunchEnabled || warmHelperCount >= WARM_POOL_SIZE) return;
+    if (launchStage == LAUNCH_RUNNING && !launchFirstFrameSeen) return;
+
+    if (SpawnWarmHelper(&warmHelpers[warmHelperCount])) warmHelperCount++;
+}
+
+void StopWarmPool() {
+    for (int i = 0; i < warmHelperCount; i++) StopWarmHelper(&warmHelpers[i]);
+    warmHelperCount = 0;
+}
+
+// Describe a waitpid() status
+// NOTE: Uses its own buffer, so the result can be passed to TextFormat()
+const char* GetExitStatusText(int status) {
+    static char text[32];       // Longest text is "killed by signal " and an int
+
+    if (status == -1) return "not run";
+    if (WIFEXITED(status)) snprintf(text, sizeof(text), "exit code %d", WEXITSTATUS(status));
+    else if (WIFSIGNALED(status)) snprintf(text, sizeof(text), "killed by signal %d", WTERMSIG(status));
+    else return "unknown";
+
+    return text;
+}
+
+// Build variant launched from the launcher for an example, also the one precompiled in the background
+const char* GetLaunchFlags(int index, bool* warm) {
+    pthread_mutex_lock(&buildMutex);
+    bool useWarm = warmLaunchEnabled && !examples[index].warmUnsupported;
+    pthread_mutex_unlock(&buildMutex);
+
+    if (warm) *warm = useWarm;
+    if (useWarm) return warmFlags;
+    return (hooksFlags[0] != '\0') ? hooksFlags : NULL;
+}
+
+// Set the background build state of an example
+void SetBuildState(int index, BuildState state) {
+    pthread_mutex_lock(&buildMutex);
+    examples[index].buildState = state;
+    pthread_mutex_unlock(&buildMutex);
+
+    RequestRedraw();
+}
+
+// Get the background build state of an example
+BuildState GetBuildState(int index) {
+    pthread_mutex_lock(&buildMutex);
+    BuildState state = examples[index].buildState;
+    pthread_mutex_unlock(&buildMutex);
+    return state;
+}
+
+// Update the build priority from the current tab and cursor
+void SetBuildFocus(int tab, int realIndex) {
+    pthread_mutex_lock(&buildMutex);
+    buildFocusTab = tab;
+    buildFocusIndex = realIndex;
+    pthread_mutex_unlock(&buildMutex);
+}
+
+// Count examples per build state, for the progress line
+void GetBuildProgress(int* ready, int* failed, int* pending) {
+    *ready = 0; *failed = 0; *pending = 0;
+
+    pthread_mutex_lock(&buildMutex);
+    for (int i = 0; i < exampleCount; i++) {
+        if (examples[i].buildState == BUILD_READY) (*ready)++;
+        else if (examples[i].buildState == BUILD_FAILED) (*failed)++;
+        else if (examples[i].buildState != BUILD_NONE) (*pending)++;
+    }
+    pthread_mutex_unlock(&buildMutex);
+}
+
+// Pick the queued example with the highest priority, must be called with buildMutex locked
+// NOTE: Examples of the focused tab come first, then by distance to the focused row
+int PickNextBuildJob() {
+    int bestIndex = -1;
+    int bestScore = 0;
+
+    for (int i = 0; i < exampleCount; i++) {
+        if (examples[i].buildState != BUILD_QUEUED) continue;
+
+        int distance = abs(i - buildFocusIndex);
+        bool inTab = (buildFocusTab == 0) || (examples[i].categoryId == buildFocusTab);
+        int score = (inTab ? 0 : exampleCount) + distance;
+
+        if (bestIndex == -1 || score < bestScore) {
+            bestIndex = i;
+            bestScore = score;
+        }
+    }
+
+    return bestIndex;
+}
+
+// Build worker thread, takes queued examples until there is nothing left or the pool is stopped
+void* BuildWorkerThread(void* arg) {
+    (void)arg;
+
+    while (true) {
+        pthread_mutex_lock(&buildMutex);
+        int index = buildPoolStop ? -1 : PickNextBuildJob();
+        if (index != -1) examples[index].buildState = BUILD_RUNNING;
+        else buildWorkersActive--;
+        pthread_mutex_unlock(&buildMutex);
+
+        if (index == -1) break;
+
+        char binaryPath[512];
+        char logPath[512];
+        const char* flags = GetLaunchFlags(index, NULL);
+        bool success = GetCachedBinaryPath(index, flags, binaryPath, sizeof(binaryPath));
+        if (!success) {
+            snprintf(logPath, sizeof(logPath), CACHE_DIR "/%s.log", examples[index].name);
+            success = BuildExample(index, flags, binaryPath, logPath);
+        }
+
+        SetBuildState(index, success ? BUILD_READY : BUILD_FAILED);
+    }
+
+    return NULL;
+}
+
+// Queue every example not built yet and start one build worker per core
+void StartBuildPool() {
+    if (buildPoolRunning) return;
+
+    pthread_mutex_lock(&buildMutex);
+    for (int i = 0; i < exampleCount; i++) {
+        if (examples[i].buildState != BUILD_READY) examples[i].buildState = BUILD_QUEUED;
+    }
+    buildPoolStop = false;
+    pthread_mutex_unlock(&buildMutex);
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    buildWorkerCount = (cores < 1) ? 1 : (cores > MAX_BUILD_WORKERS) ? MAX_BUILD_WORKERS : (int)cores;
+
+    for (int i = 0; i < buildWorkerCount; i++) {
+        pthread_mutex_lock(&buildMutex);
+        buildWorkersActive++;
+        pthread_mutex_unlock(&buildMutex);
+
+        if (pthread_create(&buildWorkers[i], NULL, BuildWorkerThread, NULL) != 0) {
+            pthread_mutex_lock(&buildMutex);
+            buildWorkersActive--;
+            pthread_mutex_unlock(&buildMutex);
+            buildWorkerCount = i;
+            break;
+        }
+    }
+
+    buildPoolRunning = true;
+    printf("Precompiling %d examples with %d workers\n", exampleCount, buildWorkerCount);
+}
+
+// Ask the build workers to stop, builds in progress are finished but nothing new is started
+// NOTE: Never waits for the workers, UpdateBuildPool() joins them once their builds are done
+void StopBuildPool() {
+    if (!buildPoolRunning) return;
+
+    pthread_mutex_lock(&buildMutex);
+    buildPoolStop = true;
+    for (int i = 0; i < exampleCount; i++) {
+        if (examples[i].buildState == BUILD_QUEUED) examples[i].buildState = BUILD_NONE;
+    }
+    pthread_mutex_unlock(&buildMutex);
+}
+
+// Check if the build pool was asked to stop and still has builds in progress
+bool IsBuildPoolStopping() {
+    pthread_mutex_lock(&buildMutex);
+    bool stopping = buildPoolRunning && buildPoolStop;
+    pthread_mutex_unlock(&buildMutex);
+
+    return stopping;
+}
+
+// Join the build workers, blocks until their builds in progress are done
+void JoinBuildPool() {
+    if (!buildPoolRunning) return;
+
+    for (int i = 0; i < buildWorkerCount; i++) pthread_join(buildWorkers[i], NULL);
+
+    buildWorkerCount = 0;
+    buildPoolRunning = false;
+}
+
+// Join the build workers of a stopped pool once all of them are idle, called every frame
+void UpdateBuildPool() {
+    if (!buildPoolRunning) return;
+
+    pthread_mutex_lock(&buildMutex);
+    bool finished = buildPoolStop && (buildWorkersActive == 0);
+    pthread_mutex_unlock(&buildMutex);
+
+    if (finished) JoinBuildPool();
+}
+
+// Thumbnail loader thread, decodes and downscales the queued screenshots
+void* ThumbnailLoaderThread(void* arg) {
+    (void)arg;
+
+    while (true) {
+        pthread_mutex_lock(&thumbMutex);
+        while (!thumbLoaderStop && thumbQueueHead >= thumbQueueCount) pthread_cond_wait(&thumbCondition, &thumbMutex);
+        if (thumbLoaderStop) {
+            pthread_mutex_unlock(&thumbMutex);
+            break;
+        }
+        int index = thumbQueue[thumbQueueHead++];
+        thumbnails[index].state = THUMB_DECODING;
+        pthread_mutex_unlock(&thumbMutex);
+
+        // Screenshot next to the example source
+        char path[256];
+        snprintf(path, sizeof(path), "%s", examples[index].filepath);
+        char* extension = strrchr(path, '.');
+        if (extension) snprintf(extension, sizeof(path) - (extension - path), ".png");
+
+        Image image = { 0 };
+        if (FileExists(path)) image = LoadImage(path);
+
+        if (image.data != NULL) {
+            // Fit the slot, keeping the aspect ratio
+            float scale = fminf((float)THUMB_WIDTH/image.width, (float)THUMB_HEIGHT/image.height);
+            int width = (int)(image.width*scale), height = (int)(image.height*scale);
+            ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+            ImageResize(&image, (width > 0) ? width : 1, (height > 0) ? height : 1);
+        }
+
+        pthread_mutex_lock(&thumbMutex);
+        if (!thumbnails[index].wanted) {
+            // Scrolled out of view while decoding, RequestThumbnails() already dropped it from the wanted list
+            if (image.data != NULL) UnloadImage(image);
+            thumbnails[index].state = THUMB_NONE;
+        } else {
+            thumbnails[index].image = image;
+            thumbnails[index].state = (image.data != NULL) ? THUMB_DECODED : THUMB_MISSING;
+        }
+        pthread_mutex_unlock(&thumbMutex);
+
+        RequestRedraw();
+    }
+
+    return NULL;
+}
+
+// Create the atlas and start the loader thread, the first time the grid is shown
+void StartThumbnailLoader() {
+    if (thumbLoaderRunning) return;
+
+    thumbnails = (Thumbnail*)calloc(exampleCount + 1, sizeof(Thumbnail));
+    thumbWanted = (int*)malloc((exampleCount + 1)*sizeof(int));
+    thumbQueue = (int*)malloc((exampleCount + 1)*sizeof(int));
+
+    Image blank = GenImageColor(THUMB_ATLAS_WIDTH, THUMB_ATLAS_HEIGHT, BLANK);
+    thumbAtlas = LoadTextureFromImage(blank);
+    UnloadImage(blank);
+    SetTextureFilter(thumbAtlas, TEXTURE_FILTER_BILINEAR);
+
+    for (int i = 0; i < THUMB_ATLAS_SLOTS; i++) thumbSlotOwner[i] = -1;
+
+    thumbLoaderStop = false;
+    thumbLoaderRunning = (pthread_create(&thumbLoader, NULL, ThumbnailLoaderThread, NULL) == 0);
+}
+
+// Stop the loader thread and release the atlas, must be called before CloseWindow()
+void StopThumbnailLoader() {
+    if (thumbnails == NULL) return;
+
+    if (thumbLoaderRunning) {
+        pthread_mutex_lock(&thumbMutex);
+        thumbLoaderStop = true;
+        pthread_cond_signal(&thumbCondition);
+        pthread_mutex_unlock(&thumbMutex);
+        pthread_join(thumbLoader, NULL);
+        thumbLoaderRunning = false;
+    }
+
+    for (int i = 0; i < exampleCount; i++) {
+        if (thumbnails[i].state == THUMB_DECODED) UnloadImage(thumbnails[i].image);
+    }
+    UnloadTexture(thumbAtlas);
+
+    free(thumbnails);
+    free(thumbWanted);
+    free(thumbQueue);
+    thumbnails = NULL;
+    thumbWanted = NULL;
+    thumbQueue = NULL;
+    thumbWantedCount = 0;
+    thumbQueueHead = thumbQueueCount = 0;
+}
+
+// Request the thumbnails of the visible and prefetched cells, in priority order
+// NOTE: Requests no longer wanted are dropped, so only a screenful of images is ever pending
+void RequestThumbnails(const int* wanted, int count) {
+    pthread_mutex_lock(&thumbMutex);
+
+    // Wanted thumbnails are never evicted
+    thumbFrame++;
+    for (int i = 0; i < count; i++) {
+        if (thumbnails[wanted[i]].state == THUMB_RESIDENT) thumbSlotLastUsed[thumbnails[wanted[i]].slot] = thumbFrame;
+    }
+
+    if (count == thumbWantedCount && memcmp(wanted, thumbWanted, count*sizeof(int)) == 0) {
+        pthread_mutex_unlock(&thumbMutex);
+        return;
+    }
+
+    for (int i = 0; i < thumbWantedCount; i++) thumbnails[thumbWanted[i]].wanted = false;
+    for (int i = 0; i < count; i++) thumbnails[wanted[i]].wanted = true;
+
+    for (int i = 0; i < thumbWantedCount; i++) {
+        Thumbnail* thumb = &thumbnails[thumbWanted[i]];
+        if (thumb->wanted) continue;
+        if (thumb->state == THUMB_QUEUED) thumb->state = THUMB_NONE;
+        if (thumb->state == THUMB_DECODED) {
+            UnloadImage(thumb->image);
+            thumb->state = THUMB_NONE;
+        }
+    }
+
+    thumbQueueHead = thumbQueueCount = 0;
+    for (int i = 0; i < count; i++) {
+        Thumbnail* thumb = &thumbnails[wanted[i]];
+        if (thumb->state == THUMB_NONE || thumb->state == THUMB_QUEUED) {
+            thumb->state = THUMB_QUEUED;
+            thumbQueue[thumbQueueCount++] = wanted[i];
+        }
+    }
+    if (thumbQueueCount > 0) pthread_cond_signal(&thumbCondition);
+
+    memcpy(thumbWanted, wanted, count*sizeof(int));
+    thumbWantedCount = count;
+    pthread_mutex_unlock(&thumbMutex);
+}
+
+// Atlas slot for a new thumbnail: a free one, or the least recently used one not wanted now, -1 if none
+int GetThumbnailSlot() {
+    int bestSlot = -1;
+
+    for (int i = 0; i < THUMB_ATLAS_SLOTS; i++) {
+        if (thumbSlotOwner[i] == -1) return i;
+        if (thumbSlotLastUsed[i] == thumbFrame) continue;
+        if (bestSlot == -1 || thumbSlotLastUsed[i] < thumbSlotLastUsed[bestSlot]) bestSlot = i;
+    }
+
+    return bestSlot;
+}
+
+// Upload a few decoded thumbnails into the atlas, the most wanted first
+void UploadThumbnails() {
+    int uploads = 0;
+
+    pthread_mutex_lock(&thumbMutex);
+    for (int i = 0; i < thumbWantedCount && uploads < THUMB_UPLOADS_PER_FRAME; i++) {
+        int index = thumbWanted[i];
+        Thumbnail* thumb = &thumbnails[index];
+        if (thumb->state != THUMB_DECODED) continue;
+
+        int slot = GetThumbnailSlot();
+        if (slot == -1) break;
+
+        // Evict the previous owner
+        if (thumbSlotOwner[slot] != -1) thumbnails[thumbSlotOwner[slot]].state = THUMB_NONE;
+
+        Rectangle rec = { (float)(slot%THUMB_ATLAS_COLUMNS*THUMB_WIDTH), (float)(slot/THUMB_ATLAS_COLUMNS*THUMB_HEIGHT),
+                          (float)thumb->image.width, (float)thumb->image.height };
+        UpdateTextureRec(thumbAtlas, rec, thumb->image.data);
+
+        thumb->width = thumb->image.width;
+        thumb->height = thumb->image.height;
+        UnloadImage(thumb->image);
+        thumb->image = (Image){ 0 };
+        thumb->slot = slot;
+        thumb->state = THUMB_RESIDENT;
+        thumbSlotOwner[slot] = index;
+        thumbSlotLastUsed[slot] = thumbFrame;
+        uploads++;
+    }
+    pthread_mutex_unlock(&thumbMutex);
+
+    // Decoded thumbnails may be left for the next frames
+    if (uploads == THUMB_UPLOADS_PER_FRAME) RequestRedraw();
+}
+
+// Trigram key of three lowercase bytes
+uint32_t GetTrigram(const char* text) {
+    return ((uint32_t)(unsigned char)text[0] << 16) | ((uint32_t)(unsigned char)text[1] << 8) | (uint32_t)(unsigned char)text[2];
+}
+
+int CompareUInt32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return (x > y) - (x < y);
+}
+
+int CompareUInt64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int CompareSearchFilePaths(const void* a, const void* b) {
+    return strcmp(((const SearchFile*)a)->path, ((const SearchFile*)b)->path);
+}
+
+// Find every raylib-examples/*/*.c file, sorted by path
+void ScanSearchFiles() {
+    int capacity = 256;
+    searchFiles = (SearchFile*)calloc(capacity, sizeof(SearchFile));
+    searchFileCount = 0;
+
+    DIR* root = opendir("raylib-examples");
+    if (!root) return;
+
+    struct dirent* category;
+    while ((category = readdir(root)) != NULL) {
+        if (category->d_name[0] == '.') continue;
+
+        char dirPath[PATH_MAX];
+        if (snprintf(dirPath, sizeof(dirPath), "raylib-examples/%s", category->d_name) >= (int)sizeof(dirPath)) continue;
+        DIR* dir = opendir(dirPath);
+        if (!dir) continue;
+
+        struct dirent* entry;
+        while ((entry = readdir(dir)) != NULL) {
+            size_t length = strlen(entry->d_name);
+            if (length < 3 || strcmp(entry->d_name + length - 2, ".c") != 0) continue;
+
+            if (searchFileCount == capacity) {
+                capacity *= 2;
+                searchFiles = (SearchFile*)realloc(searchFiles, capacity*sizeof(SearchFile));
+            }
+
+            SearchFile* file = &searchFiles[searchFileCount];
+            memset(file, 0, sizeof(SearchFile));
+            if (snprintf(file->path, sizeof(file->path), "%s/%s", dirPath, entry->d_name) >= (int)sizeof(file->path)) continue;
+
+            struct stat info;
+            if (stat(file->path, &info) != 0) continue;
+            file->mtime = (long long)info.st_mtime;
+            file->size = (long long)info.st_size;
+            searchFileCount++;
+        }
+        closedir(dir);
+    }
+    closedir(root);
+
+    qsort(searchFiles, searchFileCount, sizeof(SearchFile), CompareSearchFilePaths);
+
+    for (int i = 0; i < searchFileCount; i++) {
+        searchFiles[i].exampleIndex = -1;
+        for (int e = 0; e < exampleCount; e++) {
+            if (strcmp(examples[e].filepath, searchFiles[i].path) == 0) {
+                searchFiles[i].exampleIndex = e;
+                break;
+            }
+        }
+    }
+}
+
+// Load the text of an indexed file on first use, with a lowercase copy for matching
+// NOTE: A cached index needs no text until a query has to confirm its candidates
+void LoadSearchText(SearchFile* file) {
+    if (file->textLoaded) return;
+    file->textLoaded = true;
+
+    FILE* fp = fopen(file->path, "rb");
+    if (!fp) return;
+
+    file->text = (char*)malloc(file->size + 1);
+    file->lower = (char*)malloc(file->size + 1);
+    size_t length = fread(file->text, 1, file->size, fp);
+    fclose(fp);
+
+    file->text[length] = '\0';
+    for (size_t c = 0; c <= length; c++) file->lower[c] = (char)tolower((unsigned char)file->text[c]);
+}
+
+// Build the inverted trigram index from the texts of every file
+void BuildSearchIndex() {
+    size_t pairCapacity = 1 << 16;
+    size_t pairCount = 0;
+    uint64_t* pairs = (uint64_t*)malloc(pairCapacity*sizeof(uint64_t));
+
+    for (int i = 0; i < searchFileCount; i++) {
+        LoadSearchText(&searchFiles[i]);
+        const char* lower = searchFiles[i].lower;
+        if (!lower) continue;
+
+        // Unique trigrams of the file
+        size_t length = strlen(lower);
+        if (length < 3) continue;
+        uint32_t* trigrams = (uint32_t*)malloc(length*sizeof(uint32_t));
+        size_t trigramCount = 0;
+        for (size_t c = 0; c + 2 < length; c++) {
+            if (lower[c] == '\n' || lower[c + 1] == '\n' || lower[c + 2] == '\n') continue;
+            trigrams[trigramCount++] = GetTrigram(lower + c);
+        }
+        qsort(trigrams, trigramCount, sizeof(uint32_t), CompareUInt32);
+
+        for (size_t t = 0; t < trigramCount; t++) {
+            if (t > 0 && trigrams[t] == trigrams[t - 1]) continue;
+            if (pairCount == pairCapacity) {
+                pairCapacity *= 2;
+                pairs = (uint64_t*)realloc(pairs, pairCapacity*sizeof(uint64_t));
+            }
+            pairs[pairCount++] = ((uint64_t)trigrams[t] << 32) | (uint32_t)i;
+        }
+        free(trigrams);
+    }
+
+    // Sorting by trigram then file gives sorted posting lists
+    qsort(pairs, pairCount, sizeof(uint64_t), CompareUInt64);
+
+    searchKeys = (uint32_t*)malloc((pairCount + 1)*sizeof(uint32_t));
+    searchOffsets = (int*)malloc((pairCount + 1)*sizeof(int));
+    searchPostings = (int*)malloc((pairCount + 1)*sizeof(int));
+    searchKeyCount = 0;
+    searchPostingCount = (int)pairCount;
+
+    for (size_t p = 0; p < pairCount; p++) {
+        uint32_t key = (uint32_t)(pairs[p] >> 32);
+        if (searchKeyCount == 0 || searchKeys[searchKeyCount - 1] != key) {
+            searchKeys[searchKeyCount] = key;
+            searchOffsets[searchKeyCount] = (int)p;
+            searchKeyCount++;
+        }
+        searchPostings[p] = (int)(pairs[p] & 0xffffffff);
+    }
+    searchOffsets[searchKeyCount] = (int)pairCount;
+
+    free(pairs);
+}
+
+// Save the index with the path, mtime and size of every file it covers
+void SaveSearchIndex() {
+    mkdir(CACHE_DIR, 0755);
+
+    char tempPath[512];
+    snprintf(tempPath, sizeof(tempPath), SEARCH_CACHE_PATH ".tmp%d", (int)getpid());
+    FILE* fp = fopen(tempPath, "wb");
+    if (!fp) return;
+
+    int header[2] = { SEARCH_CACHE_VERSION, searchFileCount };
+    fwrite("RLSI", 1, 4, fp);
+    fwrite(header, sizeof(int), 2, fp);
+    for (int i = 0; i < searchFileCount; i++) {
+        fwrite(searchFiles[i].path, 1, sizeof(searchFiles[i].path), fp);
+        fwrite(&searchFiles[i].mtime, sizeof(long long), 1, fp);
+        fwrite(&searchFiles[i].size, sizeof(long long), 1, fp);
+    }
+    fwrite(&searchKeyCount, sizeof(int), 1, fp);
+    fwrite(&searchPostingCount, sizeof(int), 1, fp);
+    fwrite(searchKeys, sizeof(uint32_t), searchKeyCount, fp);
+    fwrite(searchOffsets, sizeof(int), searchKeyCount + 1, fp);
+    fwrite(searchPostings, sizeof(int), searchPostingCount, fp);
+
+    bool failed = ferror(fp);
+    fclose(fp);
+    if (failed || rename(tempPath, SEARCH_CACHE_PATH) != 0) remove(tempPath);
+}
+
+// Load the cached index, fails if any file was added, removed or modified since it was saved
+bool LoadSearchIndex() {
+    FILE* fp = fopen(SEARCH_CACHE_PATH, "rb");
+    if (!fp) return false;
+
+    bool valid = true;
+    char magic[4] = { 0 };
+    int header[2] = { 0 };
+    valid = (fread(magic, 1, 4, fp) == 4) && (memcmp(magic, "RLSI", 4) == 0) &&
+            (fread(header, sizeof(int), 2, fp) == 2) && (header[0] == SEARCH_CACHE_VERSION) && (header[1] == searchFileCount);
+
+    for (int i = 0; valid && (i < searchFileCount); i++) {
+        char path[256];
+        long long mtime = 0, size = 0;
+        valid = (fread(path, 1, sizeof(path), fp) == sizeof(path)) &&
+                (fread(&mtime, sizeof(long long), 1, fp) == 1) && (fread(&size, sizeof(long long), 1, fp) == 1) &&
+                (strncmp(path, searchFiles[i].path, sizeof(path)) == 0) &&
+                (mtime == searchFiles[i].mtime) && (size == searchFiles[i].size);
+    }
+
+    valid = valid && (fread(&searchKeyCount, sizeof(int), 1, fp) == 1) && (fread(&searchPostingCount, sizeof(int), 1, fp) == 1) &&
+            (searchKeyCount >= 0) && (searchPostingCount >= 0);
+
+    if (valid) {
+        searchKeys = (uint32_t*)malloc((searchKeyCount + 1)*sizeof(uint32_t));
+        searchOffsets = (int*)malloc((searchKeyCount + 1)*sizeof(int));
+        searchPostings = (int*)malloc((searchPostingCount + 1)*sizeof(int));
+        valid = (fread(searchKeys, sizeof(uint32_t), searchKeyCount, fp) == (size_t)searchKeyCount) &&
+                (fread(searchOffsets, sizeof(int), searchKeyCount + 1, fp) == (size_t)searchKeyCount + 1) &&
+                (fread(searchPostings, sizeof(int), searchPostingCount, fp) == (size_t)searchPostingCount);
+
+        if (!valid) {
+            free(searchKeys); free(searchOffsets); free(searchPostings);
+            searchKeys = NULL; searchOffsets = NULL; searchPostings = NULL;
+        }
+    }
+
+    fclose(fp);
+    return valid;
+}
+
+// Load the search index from the cache or build it, must be called after LoadExamplesList()
+void InitSearchIndex() {
+    double startTime = GetMonotonicTime();
+
+    ScanSearchFiles();
+
+    searchIndexFromCache = LoadSearchIndex();
+    if (!searchIndexFromCache) {
+        BuildSearchIndex();
+        SaveSearchIndex();
+    }
+
+    searchIndexTime = (GetMonotonicTime() - startTime)*1000.0;
+    printf("Search index: %d files, %d trigrams, %s in %.1f ms\n", searchFileCount, searchKeyCount,
+           searchIndexFromCache ? "loaded from cache" : "built", searchIndexTime);
+}
+
+// Free the search index and the loaded texts
+void UnloadSearchIndex() {
+    for (int i = 0; i < searchFileCount; i++) {
+        free(searchFiles[i].text);
+        free(searchFiles[i].lower);
+    }
+    free(searchFiles);
+    free(searchKeys);
+    free(searchOffsets);
+    free(searchPostings);
+    searchFiles = NULL;
+    searchFileCount = 0;
+}
+
+// Find the postings range of a trigram, returns false if no file contains it
+bool FindTrigramPostings(uint32_t key, int* start, int* end) {
+    int low = 0, high = searchKeyCount - 1;
+
+    while (low <= high) {
+        int middle = (low + high)/2;
+        if (searchKeys[middle] == key) {
+            *start = searchOffsets[middle];
+            *end = searchOffsets[middle + 1];
+            return true;
+        }
+        if (searchKeys[middle] < key) low = middle + 1;
+        else high = middle - 1;
+    }
+
+    return false;
+}
+
+int CompareSearchResults(const void* a, const void* b) {
+    const SearchResult* x = (const SearchResult*)a;
+    const SearchResult* y = (const SearchResult*)b;
+    if (x->score != y->score) return y->score - x->score;
+    return strcmp(searchFiles[x->fileIndex].path, searchFiles[y->fileIndex].path);
+}
+
+// Count the matches of the query in a candidate file and keep its first matching lines
+// NOTE: Files whose name contains the query rank first, then by number of matches
+bool MatchSearchFile(int fileIndex, const char* query, SearchResult* result) {
+    SearchFile* file = &searchFiles[fileIndex];
+    const char* name = strrchr(file->path, '/');
+    bool nameMatch = (strstr(name ? name + 1 : file->path, query) != NULL);
+
+    memset(result, 0, sizeof(SearchResult));
+    result->fileIndex = fileIndex;
+
+    LoadSearchText(file);
+    if (file->lower) {
+        int lineNumber = 1;
+        const char* lineStart = file->lower;
+        const char* scanned = file->lower;
+        const char* match = file->lower;
+        int lastLine = 0;
+
+        while ((match = strstr(match, query)) != NULL) {
+            // Advance the line count up to the match
+            for (; scanned < match; scanned++) {
+                if (*scanned == '\n') {
+                    lineNumber++;
+                    lineStart = scanned + 1;
+                }
+            }
+
+            if (lineNumber != lastLine && result->lineCount < SEARCH_RESULT_LINES) {
+                result->lineNumbers[result->lineCount] = lineNumber;
+                result->lineOffsets[result->lineCount] = (int)(lineStart - file->lower);
+                result->lineCount++;
+                lastLine = lineNumber;
+            }
+
+            result->matchCount++;
+            match += strlen(query);
+        }
+    }
+
+    if (result->matchCount == 0 && !nameMatch) return false;
+
+    result->score = result->matchCount + (nameMatch ? 100000 : 0) + ((file->exampleIndex >= 0) ? 1 : 0);
+    return true;
+}
+
+// Run the current query against the index
+void RunSearch() {
+    double startTime = GetMonotonicTime();
+    searchResultCount = 0;
+    searchTotalMatches = 0;
+    searchSelected = 0;
+    searchScroll = 0;
+
+    char query[MAX_SEARCH_QUERY];
+    for (int i = 0; i <= searchQueryLength; i++) query[i] = (char)tolower((unsigned char)searchQuery[i]);
+
+    if (searchQueryLength > 0) {
+        static SearchResult matches[4096];
+        int matchCount = 0;
+
+        if (searchQueryLength < 3) {
+            // Too short for trigrams, only file names are matched
+            for (int i = 0; (i < searchFileCount) && (matchCount < 4096); i++) {
+                const char* name = strrchr(searchFiles[i].path, '/');
+                if (strstr(name ? name + 1 : searchFiles[i].path, query)) {
+                    memset(&matches[matchCount], 0, sizeof(SearchResult));
+                    matches[matchCount].fileIndex = i;
+                    matches[matchCount].score = 100000;
+                    matchCount++;
+                }
+            }
+        } else {
+            // Intersect the postings of every query trigram, starting from the shortest list
+            int trigramCount = searchQueryLength - 2;
+            int starts[MAX_SEARCH_QUERY], ends[MAX_SEARCH_QUERY];
+            int shortest = -1;
+            bool found = true;
+
+            for (int t = 0; t < trigramCount; t++) {
+                if (!FindTrigramPostings(GetTrigram(query + t), &starts[t], &ends[t])) {
+                    found = false;
+                    break;
+                }
+                if (shortest == -1 || (ends[t] - starts[t]) < (ends[shortest] - starts[shortest])) shortest = t;
+            }
+
+            for (int p = found ? starts[shortest] : 0; found && (p < ends[shortest]) && (matchCount < 4096); p++) {
+                int fileIndex = searchPostings[p];
+                bool candidate = true;
+
+                for (int t = 0; candidate && (t < trigramCount); t++) {
+                    if (t == shortest) continue;
+
+                    // Binary search of the file in the postings of this trigram
+                    int low = starts[t], high = ends[t] - 1;
+                    candidate = false;
+                    while (low <= high) {
+                        int middle = (low + high)/2;
+                        if (searchPostings[middle] == fileIndex) { candidate = true; break; }
+                        if (searchPostings[middle] < fileIndex) low = middle + 1;
+                        else high = middle - 1;
+                    }
+                }
+
+                // Trigrams can match in different places, the text confirms the candidate
+                if (candidate && MatchSearchFile(fileIndex, query, &matches[matchCount])) matchCount++;
+            }
+        }
+
+        qsort(matches, matchCount, sizeof(SearchResult), CompareSearchResults);
+        searchTotalMatches = matchCount;
+        searchResultCount = (matchCount < MAX_SEARCH_RESULTS) ? matchCount : MAX_SEARCH_RESULTS;
+        memcpy(searchResults, matches, searchResultCount*sizeof(SearchResult));
+    }
+
+    searchTime = (GetMonotonicTime() - startTime)*1000.0;
+}
+
+// Handle typing and navigation while the search is open
+void UpdateSearch() {
+    bool changed = false;
+
+    int key = GetCharPressed();
+    while (key > 0) {
+        if (key >= 32 && key < 127 && searchQueryLength < MAX_SEARCH_QUERY - 1) {
+            searchQuery[searchQueryLength++] = (char)key;
+            searchQuery[searchQueryLength] = '\0';
+            changed = true;
+        }
+        key = GetCharPressed();
+    }
+
+    if ((IsKeyPressed(KEY_BACKSPACE) || IsKeyPressedRepeat(KEY_BACKSPACE)) && searchQueryLength > 0) {
+        searchQuery[--searchQueryLength] = '\0';
+        changed = true;
+    }
+
+    if (changed) RunSearch();
+
+    if ((IsKeyPressed(KEY_DOWN) || IsKeyPressedRepeat(KEY_DOWN)) && searchSelected < searchResultCount - 1) searchSelected++;
+    if ((IsKeyPressed(KEY_UP) || IsKeyPressedRepeat(KEY_UP)) && searchSelected > 0) searchSelected--;
+}
+
+// Draw a result line of a file, tabs expanded and trimmed to the line end
+void DrawSearchLine(const SearchFile* file, int lineNumber, int lineOffset, int x, int y) {
+    char line[160];
+    int length = 0;
+    const char* text = file->text + lineOffset;
+
+    while (*text == ' ' || *text == '\t') text++;
+    while (*text && *text != '\n' && *text != '\r' && length < (int)sizeof(line) - 1) line[length++] = *text++;
+    line[length] = '\0';
+
+    DrawText(TextFormat("%5d:", lineNumber), x, y, 10, GRAY);
+    DrawText(line, x + 40, y, 10, DARKGRAY);
+}
+
+// Draw the search bar and the ranked results in the list area
+void DrawSearchPanel(int screenWidth, int screenHeight) {
+    int listY = 60;
+    int barHeight = 36;
+    int itemHeight = 58;
+    int footerHeight = 120 + (logPanelVisible ? LOG_PANEL_HEIGHT : 0);
+    int visibleItems = (screenHeight - listY - barHeight - footerHeight)/itemHeight;
+
+    // Search bar
+    DrawRectangle(10, listY, screenWidth - 30, barHeight - 4, WHITE);
+    DrawRectangleLinesEx((Rectangle){ 10, listY, screenWidth - 30, barHeight - 4 }, 2, SKYBLUE);
+    DrawText(TextFormat("Search: %s_", searchQuery), 20, listY + 7, 18, BLACK);
+    const char* stats = TextFormat("%d files  |  %.3f ms  |  index: %d files, %s",
+        searchTotalMatches, searchTime, searchFileCount, searchIndexFromCache ? "cached" : "rebuilt");
+    DrawText(stats, screenWidth - 30 - MeasureText(stats, 14), listY + 10, 14, GRAY);
+
+    // Results
+    if (searchSelected < searchScroll) searchScroll = searchSelected;
+    if (searchSelected >= searchScroll + visibleItems) searchScroll = searchSelected - visibleItems + 1;
+
+    for (int r = searchScroll; (r < searchResultCount) && (r < searchScroll + visibleItems); r++) {
+        const SearchResult* result = &searchResults[r];
+        const SearchFile* file = &searchFiles[result->fileIndex];
+        int yPos = listY + barHeight + (r - searchScroll)*itemHeight;
+
+        DrawRectangle(10, yPos, screenWidth - 30, itemHeight - 2, (r == searchSelected) ? Fade(SKYBLUE, 0.4f) : RAYWHITE);
+
+        int exampleIndex = file->exampleIndex;
+        Color catColor = (exampleIndex >= 0) ? GetCategoryColor(examples[exampleIndex].categoryId) : GRAY;
+        DrawCircle(30, yPos + 14, 8, catColor);
+        DrawText(file->path + strlen("raylib-examples/"), 50, yPos + 5, 18, (exampleIndex >= 0) ? BLACK : GRAY);
+        DrawText(TextFormat("%d matches%s", result->matchCount, (exampleIndex >= 0) ? "" : "  (not in launcher list)"),
+            screenWidth - 260, yPos + 8, 14, GRAY);
+
+        for (int l = 0; l < result->lineCount; l++) {
+            DrawSearchLine(file, result->lineNumbers[l], result->lineOffsets[l], 50, yPos + 27 + l*13);
+        }
+    }
+
+    if (searchQueryLength > 0 && searchResultCount == 0) {
+        DrawText("No matches", 20, listY + barHeight + 10, 18, GRAY);
+    }
+}
+
+// Text of a source line, without its line break
+int GetSourceLine(int line, const char** text) {
+    int start = viewerLineOffsets[line];
+    int end = viewerLineOffsets[line + 1] - 1;
+    if (end > (int)viewerSize) end = (int)viewerSize;
+    if (end > start && viewerData[end - 1] == '\r') end--;
+
+    *text = viewerData + start;
+    return end - start;
+}
+
+// Copy part of a line for drawing, with tabs expanded to spaces
+const char* GetSourceText(const char* text, int length) {
+    static char buffer[VIEWER_MAX_LINE_LENGTH*VIEWER_TAB_SPACES + 1];
+    int size = 0;
+
+    for (int i = 0; i < length && size < (int)sizeof(buffer) - VIEWER_TAB_SPACES; i++) {
+        if (text[i] == '\t') for (int s = 0; s < VIEWER_TAB_SPACES; s++) buffer[size++] = ' ';
+        else buffer[size++] = text[i];
+    }
+    buffer[size] = '\0';
+
+    return buffer;
+}
+
+bool IsSourceWord(const char* text, int length, const char* const* words) {
+    for (int i = 0; words[i] != NULL; i++) {
+        if ((int)strlen(words[i]) == length && memcmp(words[i], text, length) == 0) return true;
+    }
+    return false;
+}
+
+// Classify an identifier
+TokenKind GetIdentifierKind(const char* text, int length, const char* next, const char* end) {
+    static const char* const keywords[] = {
+        "auto", "break", "case", "const", "continue", "default", "do", "else", "enum", "extern", "for", "goto", "if",
+        "inline", "register", "restrict", "return", "sizeof", "static", "struct", "switch", "typedef", "union",
+        "volatile", "while", "true", "false", "NULL", NULL
+    };
+    static const char* const types[] = {
+        "void", "char", "short", "int", "long", "float", "double", "signed", "unsigned", "bool", "size_t",
+        "int8_t", "int16_t", "int32_t", "int64_t", "uint8_t", "uint16_t", "uint32_t", "uint64_t", NULL
+    };
+
+    if (IsSourceWord(text, length, keywords)) return TOKEN_KEYWORD;
+    if (IsSourceWord(text, length, types)) return TOKEN_TYPE;
+
+    while (next < end && (*next == ' ' || *next == '\t')) next++;
+    if (next < end && *next == '(') return TOKEN_FUNCTION;
+
+    // raylib types are capitalized: Vector2, Color, Camera3D...
+    if (text[0] >= 'A' && text[0] <= 'Z' && length > 1 && islower((unsigned char)text[1])) return TOKEN_TYPE;
+
+    return TOKEN_PLAIN;
+}
+
+// Append a token, merged with the previous one when it has the same kind
+void AddSourceToken(SourceToken* tokens, int* count, int start, int length, TokenKind kind) {
+    if (length <= 0) return;
+
+    if (*count > 0) {
+        SourceToken* last = &tokens[*count - 1];
+        if (last->kind == kind && last->start + last->length == start) {
+            last->length += length;
+            return;
+        }
+    }
+    tokens[(*count)++] = (SourceToken){ (short)start, (short)length, 0, (unsigned char)kind };
+}
+
+// Scan a line of C source, returns whether it ends inside a block comment
+// NOTE: Without tokens only the comment state is tracked, to find where the next lines start
+bool TokenizeSourceLine(const char* text, int length, bool inComment, SourceToken* tokens, int* tokenCount) {
+    int count = 0;
+    int i = 0;
+
+    // Continue a block comment
+    if (inComment) {
+        while (i < length && !(text[i] == '*' && i + 1 < length && text[i + 1] == '/')) i++;
+        inComment = (i >= length);
+        if (!inComment) i += 2;
+        if (tokens) AddSourceToken(tokens, &count, 0, i, TOKEN_COMMENT);
+    }
+
+    // Preprocessor directive
+    int first = i;
+    while (first < length && (text[first] == ' ' || text[first] == '\t')) first++;
+    if (!inComment && first < length && text[first] == '#') {
+        int end = first + 1;
+        while (end < length && (text[end] == ' ' || isalpha((unsigned char)text[end]))) end++;
+        if (tokens) AddSourceToken(tokens, &count, i, end - i, TOKEN_PREPROCESSOR);
+        i = end;
+    }
+
+    while (i < length && !inComment) {
+        char c = text[i];
+        int start = i;
+        TokenKind kind = TOKEN_PLAIN;
+
+        if (c == '/' && i + 1 < length && text[i + 1] == '/') {
+            i = length;
+            kind = TOKEN_COMMENT;
+        } else if (c == '/' && i + 1 < length && text[i + 1] == '*') {
+            i += 2;
+            while (i < length && !(text[i] == '*' && i + 1 < length && text[i + 1] == '/')) i++;
+            inComment = (i >= length);
+            if (!inComment) i += 2;
+            kind = TOKEN_COMMENT;
+        } else if (c == '"' || c == '\'') {
+            i++;
+            while (i < length && text[i] != c) i += (text[i] == '\\') ? 2 : 1;
+            if (i < length) i++;
+            if (i > length) i = length;
+            kind = TOKEN_STRING;
+        } else if (isdigit((unsigned char)c) || (c == '.' && i + 1 < length && isdigit((unsigned char)text[i + 1]))) {
+            while (i < length && (isalnum((unsigned char)text[i]) || text[i] == '.')) i++;
+            kind = TOKEN_NUMBER;
+        } else if (isalpha((unsigned char)c) || c == '_') {
+            while (i < length && (isalnum((unsigned char)text[i]) || text[i] == '_')) i++;
+            if (tokens) kind = GetIdentifierKind(text + start, i - start, text + i, text + length);
+        } else {
+            i++;
+        }
+
+        if (tokens) AddSourceToken(tokens, &count, start, i - start, kind);
+    }
+
+    if (tokenCount) *tokenCount = count;
+    return inComment;
+}
+
+// Close the source viewer and release the mapping and the token cache
+void CloseSourceViewer() {
+    if (viewerData != NULL && viewerSize > 0) munmap((void*)viewerData, viewerSize);
+    for (int i = 0; i < viewerLineCount; i++) free(viewerLines[i].tokens);
+    free(viewerLines);
+    free(viewerLineOffsets);
+    free(viewerInComment);
+
+    viewerData = NULL;
+    viewerSize = 0;
+    viewerLines = NULL;
+    viewerLineOffsets = NULL;
+    viewerInComment = NULL;
+    viewerLineCount = viewerTokenizedCount = 0;
+    viewerActive = false;
+}
+
+// Map a source file and index its lines, returns false if it can not be opened
+bool OpenSourceViewer(const char* path) {
+    CloseSourceViewer();
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        close(fd);
+        return false;
+    }
+
+    viewerSize = (size_t)st.st_size;
+    viewerData = "";
+    if (viewerSize > 0) {
+        void* mapping = mmap(NULL, viewerSize, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            viewerSize = 0;
+            viewerData = NULL;
+            return false;
+        }
+        viewerData = (const char*)mapping;
+    }
+    close(fd);
+
+    // Line offsets, the only full pass over the file
+    int capacity = 1024;
+    viewerLineOffsets = (int*)malloc(capacity*sizeof(int));
+    viewerLineOffsets[viewerLineCount++] = 0;
+    for (const char* c = viewerData; (c = memchr(c, '\n', viewerData + viewerSize - c)) != NULL; c++) {
+        if (c + 1 == viewerData + viewerSize) break;
+        if (viewerLineCount + 1 >= capacity) {
+            capacity *= 2;
+            viewerLineOffsets = (int*)realloc(viewerLineOffsets, capacity*sizeof(int));
+        }
+        viewerLineOffsets[viewerLineCount++] = (int)(c + 1 - viewerData);
+    }
+    viewerLineOffsets[viewerLineCount] = (viewerSize > 0 && viewerData[viewerSize - 1] == '\n') ? (int)viewerSize : (int)viewerSize + 1;
+
+    viewerLines = (SourceLine*)calloc(viewerLineCount, sizeof(SourceLine));
+
+    // Block comment state at the start of every line, so any line can be tokenized on its own
+    viewerInComment = (bool*)calloc(viewerLineCount + 1, sizeof(bool));
+    for (int line = 0; line < viewerLineCount; line++) {
+        const char* text;
+        int length = GetSourceLine(line, &text);
+        viewerInComment[line + 1] = TokenizeSourceLine(text, length, viewerInComment[line], NULL, NULL);
+    }
+
+    snprintf(viewerPath, sizeof(viewerPath), "%s", path);
+    viewerScroll = 0;
+    viewerScrollX = 0;
+    viewerActive = true;
+
+    return true;
+}
+
+// Tokens of a line, tokenized and cached on first use
+SourceLine* GetSourceLineTokens(int line) {
+    SourceLine* sourceLine = &viewerLines[line];
+    if (sourceLine->tokens != NULL) return sourceLine;
+
+    const char* text;
+    int length = GetSourceLine(line, &text);
+    if (length > VIEWER_MAX_LINE_LENGTH) length = VIEWER_MAX_LINE_LENGTH;
+
+    SourceToken tokens[VIEWER_MAX_LINE_LENGTH];
+    int count = 0;
+    TokenizeSourceLine(text, length, viewerInComment[line], tokens, &count);
+
+    // Token positions, measured once with the spacing MeasureText() leaves out of every piece
+    int x = 0;
+    for (int t = 0; t < count; t++) {
+        tokens[t].x = (short)x;
+        x += MeasureText(GetSourceText(text + tokens[t].start, tokens[t].length), VIEWER_FONT_SIZE) + VIEWER_FONT_SIZE/10;
+    }
+
+    sourceLine->tokens = (SourceToken*)malloc((count + 1)*sizeof(SourceToken));
+    memcpy(sourceLine->tokens, tokens, count*sizeof(SourceToken));
+    sourceLine->tokenCount = count;
+    viewerTokenizedCount++;
+
+    return sourceLine;
+}
+
+Color GetTokenColor(TokenKind kind) {
+    switch (kind) {
+        case TOKEN_KEYWORD: return (Color){ 170, 50, 160, 255 };
+        case TOKEN_TYPE: return (Color){ 30, 90, 180, 255 };
+        case TOKEN_FUNCTION: return (Color){ 0, 120, 140, 255 };
+        case TOKEN_PREPROCESSOR: return (Color){ 190, 100, 0, 255 };
+        case TOKEN_COMMENT: return (Color){ 110, 150, 110, 255 };
+        case TOKEN_STRING: return (Color){ 180, 60, 40, 255 };
+        case TOKEN_NUMBER: return (Color){ 20, 140, 90, 255 };
+        default: return DARKGRAY;
+    }
+}
+
+// Path of a quoted #include on a source line, relative to the launcher directory
+// NOTE: Only local includes are followed, the directory of the shown file is searched like the compiler does
+bool GetIncludePath(const char* text, int length, char* path, int size) {
+    const char* end = text + length;
+    while (text < end && (*text == ' ' || *text == '\t')) text++;
+    if (text == end || *text++ != '#') return false;
+    while (text < end && (*text == ' ' || *text == '\t')) text++;
+    if (end - text < 7 || strncmp(text, "include", 7) != 0) return false;
+    text += 7;
+    while (text < end && (*text == ' ' || *text == '\t')) text++;
+    if (text == end || *text++ != '"') return false;
+
+    const char* name = text;
+    while (text < end && *text != '"') text++;
+    if (text == end || text == name) return false;
+
+    const char* slash = strrchr(viewerPath, '/');
+    int dirLength = slash ? (int)(slash - viewerPath) + 1 : 0;
+    return (snprintf(path, size, "%.*s%.*s", dirLength, viewerPath, (int)(text - name), name) < size);
+}
+
+// Open the first local include of the visible lines, the shown file is kept to come back to it
+void OpenViewerInclude() {
+    char path[PATH_MAX];
+    bool found = false;
+
+    int lastLine = viewerScroll + viewerVisibleLines;
+    if (lastLine > viewerLineCount) lastLine = viewerLineCount;
+    for (int line = viewerScroll; !found && line < lastLine; line++) {
+        const char* text = NULL;
+        int length = GetSourceLine(line, &text);
+        found = GetIncludePath(text, length, path, sizeof(path));
+    }
+
+    if (!found) {
+        LogMessage(GRAY, "No local #include on the shown lines");
+        return;
+    }
+
+    char parentPath[256];
+    int parentScroll = viewerScroll;
+    snprintf(parentPath, sizeof(parentPath), "%s", viewerPath);
+
+    if (!OpenSourceViewer(path)) {
+        LogMessage(RED, TextFormat("Could not open %s: %s", path, strerror(errno)));
+        if (OpenSourceViewer(parentPath)) viewerScroll = parentScroll;
+        return;
+    }
+
+    snprintf(viewerParentPath, sizeof(viewerParentPath), "%s", parentPath);
+    viewerParentScroll = parentScroll;
+}
+
+// Go back to the file the shown include was opened from
+void CloseViewerInclude() {
+    if (viewerParentPath[0] == '\0') return;
+
+    char path[256];
+    snprintf(path, sizeof(path), "%s", viewerParentPath);
+    viewerParentPath[0] = '\0';
+
+    if (OpenSourceViewer(path)) viewerScroll = viewerParentScroll;
+    else LogMessage(RED, TextFormat("Could not open %s: %s", path, strerror(errno)));
+}
+
+// Source viewer keyboard and mouse scrolling
+void UpdateSourceViewer() {
+    int lastScroll = viewerLineCount - viewerVisibleLines;
+    if (lastScroll < 0) lastScroll = 0;
+
+    if (IsKeyPressed(KEY_DOWN) || IsKeyPressedRepeat(KEY_DOWN)) viewerScroll++;
+    if (IsKeyPressed(KEY_UP) || IsKeyPressedRepeat(KEY_UP)) viewerScroll--;
+    if (IsKeyPressed(KEY_PAGE_DOWN) || IsKeyPressedRepeat(KEY_PAGE_DOWN)) viewerScroll += viewerVisibleLines;
+    if (IsKeyPressed(KEY_PAGE_UP) || IsKeyPressedRepeat(KEY_PAGE_UP)) viewerScroll -= viewerVisibleLines;
+    if (IsKeyPressed(KEY_HOME)) viewerScroll = 0;
+    if (IsKeyPressed(KEY_END)) viewerScroll = lastScroll;
+    viewerScroll -= (int)(GetMouseWheelMove()*3);
+
+    if (IsKeyPressed(KEY_RIGHT) || IsKeyPressedRepeat(KEY_RIGHT)) viewerScrollX += 80;
+    if (IsKeyPressed(KEY_LEFT) || IsKeyPressedRepeat(KEY_LEFT)) viewerScrollX -= 80;
+
+    // Includes can be followed, an opened file has a new line count
+    if (IsKeyPressed(KEY_ENTER)) {
+        OpenViewerInclude();
+        return;
+    }
+    if (IsKeyPressed(KEY_BACKSPACE)) {
+        CloseViewerInclude();
+        return;
+    }
+
+    if (viewerScroll > lastScroll) viewerScroll = lastScroll;
+    if (viewerScroll < 0) viewerScroll = 0;
+    if (viewerScrollX < 0) viewerScrollX = 0;
+}
+
+// Draw the visible lines of the source viewer in the list area
+void DrawSourceViewer(int screenWidth, int screenHeight) {
+    int listY = 60;
+    int barHeight = 36;
+    int footerHeight = 120 + (logPanelVisible ? LOG_PANEL_HEIGHT : 0);
+    int textY = listY + barHeight;
+    int textHeight = screenHeight - textY - footerHeight;
+    viewerVisibleLines = textHeight/VIEWER_LINE_HEIGHT;
+    if (viewerVisibleLines < 1) viewerVisibleLines = 1;
+
+    int lastLine = viewerScroll + viewerVisibleLines;
+    if (lastLine > viewerLineCount) lastLine = viewerLineCount;
+
+    // Header
+    DrawRectangle(10, listY, screenWidth - 30, barHeight - 4, WHITE);
+    DrawRectangleLinesEx((Rectangle){ 10, listY, screenWidth - 30, barHeight - 4 }, 2, SKYBLUE);
+    DrawText(viewerPath, 20, listY + 7, 18, BLACK);
+    const char* stats = TextFormat("lines %d-%d of %d  |  %d tokenized  |  ENTER include%s  |  ESC or C to close",
+        viewerScroll + 1, lastLine, viewerLineCount, viewerTokenizedCount, (viewerParentPath[0] != '\0') ? ", BACKSPACE back" : "");
+    DrawText(stats, screenWidth - 30 - MeasureText(stats, 14), listY + 10, 14, GRAY);
+
+    // Line numbers gutter
+    int gutterWidth = MeasureText(TextFormat("%d", viewerLineCount), VIEWER_FONT_SIZE) + 20;
+    int textX = 10 + gutterWidth + 8;
+    DrawRectangle(10, textY, screenWidth - 30, textHeight, RAYWHITE);
+    DrawRectangle(10, textY, gutterWidth, textHeight, (Color){ 230, 230, 230, 255 });
+
+    BeginScissorMode(textX, textY, screenWidth - 30 - (textX - 10), textHeight);
+    for (int line = viewerScroll; line < lastLine; line++) {
+        int y = textY + (line - viewerScroll)*VIEWER_LINE_HEIGHT + 2;
+        const SourceLine* sourceLine = GetSourceLineTokens(line);
+
+        const char* text;
+        GetSourceLine(line, &text);
+
+        for (int t = 0; t < sourceLine->tokenCount; t++) {
+            const SourceToken* token = &sourceLine->tokens[t];
+            int x = textX + token->x - viewerScrollX;
+            if (x > screenWidth) break;
+            if (token->kind == TOKEN_PLAIN && text[token->start] == ' ' && token->length == 1) continue;
+
+            const char* tokenText = GetSourceText(text + token->start, token->length);
+            if (x + MeasureText(tokenText, VIEWER_FONT_SIZE) < textX) continue;
+            DrawText(tokenText, x, y, VIEWER_FONT_SIZE, GetTokenColor((TokenKind)token->kind));
+        }
+    }
+    EndScissorMode();
+
+    for (int line = viewerScroll; line < lastLine; line++) {
+        const char* number = TextFormat("%d", line + 1);
+        int y = textY + (line - viewerScroll)*VIEWER_LINE_HEIGHT + 2;
+        DrawText(number, 10 + gutterWidth - 10 - MeasureText(number, VIEWER_FONT_SIZE), y, VIEWER_FONT_SIZE, GRAY);
+    }
+
+    // Scrollbar
+    if (viewerLineCount > viewerVisibleLines) {
+        float scrollbarHeight = ((float)viewerVisibleLines/viewerLineCount)*textHeight;
+        float scrollbarY = textY + ((float)viewerScroll/viewerLineCount)*textHeight;
+        DrawRectangle(screenWidth - 18, scrollbarY, 14, scrollbarHeight, GRAY);
+        DrawRectangleLines(screenWidth - 18, textY, 14, textHeight, LIGHTGRAY);
+    }
+}
+
+// Draw tabs at the top
+void DrawTabs(int screenWidth) {
+    int tabWidth = screenWidth / TAB_COUNT;
+    int tabHeight = 50;
+
+    for (int i = 0; i < TAB_COUNT; i++) {
+        int x = i * tabWidth;
+
+        // Tab background
+        Color bgColor = (i == activeTab) ? tabs[i].color : Fade(tabs[i].color, 0.3f);
+        DrawRectangle(x, 0, tabWidth - 2, tabHeight, bgColor);
+
+        // Tab border
+        if (i == activeTab) {
+            DrawRectangleLinesEx((Rectangle){x, 0, tabWidth - 2, tabHeight}, 3, WHITE);
+        }
+
+        // Tab text
+        const char* tabText = TextFormat("%s (%d)", tabs[i].name, tabs[i].count);
+        int textWidth = MeasureText(tabText, 18);
+        Color textColor = (i == activeTab) ? WHITE : LIGHTGRAY;
+        DrawText(tabText, x + (tabWidth - textWidth) / 2, 16, 18, textColor);
+    }
+}
+
+// Draw the example list
+void DrawExampleList(int screenWidth, int screenHeight) {
+    int tabHeight = 50;
+    int listY = tabHeight + 10;
+    int itemHeight = 40;
+    int footerHeight = 120 + (logPanelVisible ? LOG_PANEL_HEIGHT : 0);
+    int visibleHeight = screenHeight - listY - footerHeight;
+    maxVisibleItems = visibleHeight / itemHeight;
+
+    int filteredCount = GetFilteredExampleCount();
+
+    // Adjust scroll offset
+    if (selectedExample < scrollOffset) scrollOffset = selectedExample;
+    if (selectedExample >= scrollOffset + maxVisibleItems) scrollOffset = selectedExample - maxVisibleItems + 1;
+
+    // Draw example list, only the visible rows are visited
+    int selectedIndex = GetRealIndexFromFiltered(selectedExample);
+    int hoveredIndex = GetFilteredIndexAtPosition(GetMousePosition(), screenWidth);
+    int lastVisible = scrollOffset + maxVisibleItems;
+    if (lastVisible > filteredCount) lastVisible = filteredCount;
+
+    for (int displayIndex = scrollOffset; displayIndex < lastVisible; displayIndex++) {
+        int i = GetRealIndexFromFiltered(displayIndex);
+        int yPos = listY + (displayIndex - scrollOffset) * itemHeight;
+        bool isHovered = (displayIndex == hoveredIndex);
+
+        // Background
+        Color bgColor;
+        if (i == selectedIndex) {
+            bgColor = Fade(GetCategoryColor(examples[i].categoryId), 0.5f);
+        } else if (isHovered) {
+            bgColor = Fade(LIGHTGRAY, 0.8f);
+        } else if (examples[i].regressed) {
+            bgColor = (Color){ 255, 225, 225, 255 };
+        } else {
+            bgColor = RAYWHITE;
+        }
+        DrawRectangle(10, yPos, screenWidth - 30, itemHeight - 2, bgColor);
+
+        // Border on hover
+        if (isHovered) {
+            DrawRectangleLinesEx((Rectangle){10, yPos, screenWidth - 30, itemHeight - 2}, 2, GRAY);
+        }
+
+        // Category indicator circle
+        Color catColor = GetCategoryColor(examples[i].categoryId);
+        DrawCircle(30, yPos + itemHeight/2, 8, catColor);
+
+        // Difficulty stars
+        DrawText(examples[i].difficulty, 50, yPos + 10, 16, GOLD);
+
+        // Example name
+        Color textColor = (i == selectedIndex) ? BLACK : DARKGRAY;
+        DrawText(examples[i].name, 130, yPos + 10, 20, textColor);
+
+        // Build state
+        const char* stateText = NULL;
+        Color stateColor = GRAY;
+        switch (GetBuildState(i)) {
+            case BUILD_QUEUED: stateText = "queued"; stateColor = GRAY; break;
+            case BUILD_RUNNING: stateText = "building..."; stateColor = ORANGE; break;
+            case BUILD_READY: stateText = "ready"; stateColor = LIME; break;
+            case BUILD_FAILED: stateText = "build failed"; stateColor = RED; break;
+            default: break;
+        }
+        if (stateText) DrawText(stateText, screenWidth - 40 - MeasureText(stateText, 16), yPos + 12, 16, stateColor);
+
+        // Benchmark regression
+        if (examples[i].regressed) DrawText("REGRESSED", screenWidth - 160 - MeasureText("REGRESSED", 16), yPos + 12, 16, RED);
+    }
+
+    // Scrollbar
+    if (filteredCount > maxVisibleItems) {
+        float scrollbarHeight = ((float)maxVisibleItems / filteredCount) * visibleHeight;
+        float scrollbarY = listY + ((float)scrollOffset / filteredCount) * visibleHeight;
+        DrawRectangle(screenWidth - 18, scrollbarY, 14, scrollbarHeight, GRAY);
+        DrawRectangleLines(screenWidth - 18, listY, 14, visibleHeight, LIGHTGRAY);
+    }
+}
+
+// Draw the examples as a grid of screenshots
+void DrawExampleGrid(int screenWidth, int screenHeight) {
+    int listY = 50 + 10;
+    int footerHeight = 120 + (logPanelVisible ? LOG_PANEL_HEIGHT : 0);
+    int visibleHeight = screenHeight - listY - footerHeight;
+    int visibleRows = visibleHeight/GRID_CELL_HEIGHT;
+    if (visibleRows < 1) visibleRows = 1;
+    gridColumns = (screenWidth - 30)/GRID_CELL_WIDTH;
+    if (gridColumns < 1) gridColumns = 1;
+    maxVisibleItems = gridColumns*visibleRows;
+
+    int filteredCount = GetFilteredExampleCount();
+
+    // Adjust scroll offset, always the first cell of a row
+    int firstRow = scrollOffset/gridColumns;
+    int selectedRow = selectedExample/gridColumns;
+    if (selectedRow < firstRow) firstRow = selectedRow;
+    if (selectedRow >= firstRow + visibleRows) firstRow = selectedRow - visibleRows + 1;
+    scrollOffset = firstRow*gridColumns;
+
+    int firstVisible = scrollOffset;
+    int lastVisible = scrollOffset + maxVisibleItems;
+    if (lastVisible > filteredCount) lastVisible = filteredCount;
+
+    // Visible cells first, then the rows below and above
+    int prefetch = THUMB_PREFETCH_ROWS*gridColumns;
+    static int* wanted = NULL;
+    static int wantedCapacity = 0;
+    if (wantedCapacity < maxVisibleItems + 2*prefetch) {
+        wantedCapacity = maxVisibleItems + 2*prefetch;
+        wanted = (int*)realloc(wanted, wantedCapacity*sizeof(int));
+    }
+
+    int wantedCount = 0;
+    for (int i = firstVisible; i < lastVisible; i++) wanted[wantedCount++] = GetRealIndexFromFiltered(i);
+    for (int i = lastVisible; i < lastVisible + prefetch && i < filteredCount; i++) wanted[wantedCount++] = GetRealIndexFromFiltered(i);
+    for (int i = firstVisible - 1; i >= firstVisible - prefetch && i >= 0; i--) wanted[wantedCount++] = GetRealIndexFromFiltered(i);
+
+    RequestThumbnails(wanted, wantedCount);
+    UploadThumbnails();
+
+    int selectedIndex = GetRealIndexFromFiltered(selectedExample);
+    int hoveredIndex = GetFilteredIndexAtPosition(GetMousePosition(), screenWidth);
+
+    for (int displayIndex = firstVisible; displayIndex < lastVisible; displayIndex++) {
+        int i = GetRealIndexFromFiltered(displayIndex);
+        int cell = displayIndex - firstVisible;
+        int x = 10 + (cell%gridColumns)*GRID_CELL_WIDTH;
+        int y = listY + (cell/gridColumns)*GRID_CELL_HEIGHT;
+        Color catColor = GetCategoryColor(examples[i].categoryId);
+
+        // Background
+        Color bgColor = RAYWHITE;
+        if (i == selectedIndex) bgColor = Fade(catColor, 0.5f);
+        else if (displayIndex == hoveredIndex) bgColor = Fade(LIGHTGRAY, 0.8f);
+        else if (examples[i].regressed) bgColor = (Color){ 255, 225, 225, 255 };
+        DrawRectangle(x, y, GRID_CELL_WIDTH - 6, GRID_CELL_HEIGHT - 6, bgColor);
+        if (displayIndex == hoveredIndex) DrawRectangleLinesEx((Rectangle){ x, y, GRID_CELL_WIDTH - 6, GRID_CELL_HEIGHT - 6 }, 2, GRAY);
+
+        // Thumbnail, or a placeholder until it is in the atlas
+        int thumbX = x + (GRID_CELL_WIDTH - 6 - THUMB_WIDTH)/2;
+        int thumbY = y + 4;
+        Thumbnail* thumb = &thumbnails[i];
+        pthread_mutex_lock(&thumbMutex);
+        ThumbState thumbState = thumb->state;
+        pthread_mutex_unlock(&thumbMutex);
+
+        if (thumbState == THUMB_RESIDENT) {
+            Rectangle source = { (float)(thumb->slot%THUMB_ATLAS_COLUMNS*THUMB_WIDTH), (float)(thumb->slot/THUMB_ATLAS_COLUMNS*THUMB_HEIGHT),
+                                 (float)thumb->width, (float)thumb->height };
+            Vector2 position = { (float)(thumbX + (THUMB_WIDTH - thumb->width)/2), (float)(thumbY + (THUMB_HEIGHT - thumb->height)/2) };
+            DrawTextureRec(thumbAtlas, source, position, WHITE);
+        } else {
+            const char* placeholder = (thumbState == THUMB_MISSING) ? "no preview" : "loading...";
+            DrawRectangle(thumbX, thumbY, THUMB_WIDTH, THUMB_HEIGHT, Fade(catColor, 0.2f));
+            DrawText(placeholder, thumbX + (THUMB_WIDTH - MeasureText(placeholder, 14))/2, thumbY + THUMB_HEIGHT/2 - 7, 14, GRAY);
+        }
+
+        // Category bar and name, cut to the cell width
+        DrawRectangle(thumbX, thumbY + THUMB_HEIGHT + 4, 4, 16, catColor);
+        char name[MAX_NAME_LENGTH];
+        snprintf(name, sizeof(name), "%s", examples[i].name);
+        int length = (int)strlen(name);
+        while (length > 3 && MeasureText(name, 14) > THUMB_WIDTH - 8) {
+            length--;
+            memcpy(name + length - 3, "...", 4);
+        }
+        DrawText(name, thumbX + 8, thumbY + THUMB_HEIGHT + 6, 14, (i == selectedIndex) ? BLACK : DARKGRAY);
+
+        // Build state
+        BuildState buildState = GetBuildState(i);
+        if (buildState != BUILD_NONE) {
+            Color stateColor = (buildState == BUILD_READY) ? LIME : (buildState == BUILD_FAILED) ? RED : (buildState == BUILD_RUNNING) ? ORANGE : GRAY;
+            DrawCircle(thumbX + THUMB_WIDTH - 8, thumbY + 8, 5, stateColor);
+        }
+        if (examples[i].regressed) DrawText("REGRESSED", thumbX + 4, thumbY + 4, 10, RED);
+    }
+
+    // Scrollbar
+    if (filteredCount > maxVisibleItems) {
+        float scrollbarHeight = ((float)maxVisibleItems/filteredCount)*visibleHeight;
+        float scrollbarY = listY + ((float)scrollOffset/filteredCount)*visibleHeight;
+        DrawRectangle(screenWidth - 18, scrollbarY, 14, scrollbarHeight, GRAY);
+        DrawRectangleLines(screenWidth - 18, listY, 14, visibleHeight, LIGHTGRAY);
+    }
+}
+
+// Read the CPU time (s), resident set size (MB) and thread count of a running process
+// NOTE: Linux /proc only, elsewhere only the frame timings and the final resource use are known
+bool ReadProcessStats(pid_t pid, double* cpuTime, float* rss, int* threads) {
+    char path[64], line[1024];
+    snprintf(path, sizeof(path), "/proc/%d/stat", (int)pid);
+
+    FILE* fp = fopen(path, "r");
+    if (!fp) return false;
+    bool lineRead = (fgets(line, sizeof(line), fp) != NULL);
+    fclose(fp);
+    if (!lineRead) return false;
+
+    // The command name may contain spaces and parentheses, fields are counted from the last ')'
+    const char* fields = strrchr(line, ')');
+    if (!fields) return false;
+
+    char state = 0;
+    unsigned long utime = 0, stime = 0;
+    long threadCount = 0, rssPages = 0;
+    if (sscanf(fields + 1, " %c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %lu %lu %*d %*d %*d %*d %ld %*d %*u %*u %ld",
+               &state, &utime, &stime, &threadCount, &rssPages) != 5) return false;
+
+    // A zombie has already released its memory, its last sample is the meaningful one
+    if (state == 'Z') return false;
+
+    *cpuTime = (double)(utime + stime)/sysconf(_SC_CLK_TCK);
+    *rss = (float)((double)rssPages*sysconf(_SC_PAGESIZE)/(1024.0*1024.0));
+    *threads = (int)threadCount;
+    return true;
+}
+
+// Start following a new run, the process may be a warm helper that already used some resources
+void ResetResourceMonitor(const ChildProcess* process) {
+    ResourceMonitor* monitor = &resourceMonitor;
+    memset(monitor, 0, sizeof(ResourceMonitor));
+
+    if (process->monitor) monitor->frameRead = atomic_load_explicit(&process->monitor->written, memory_order_acquire);
+
+    float rss = 0;
+    int threads = 0;
+    if (ReadProcessStats(process->pid, &monitor->cpuTime, &rss, &threads)) monitor->startCpuTime = monitor->cpuTime;
+    monitor->sampleTime = GetTime();
+}
+
+// Read the frames published by the running example since the last call
+void ReadMonitorFrames(LauncherMonitorRing* ring) {
+    ResourceMonitor* monitor = &resourceMonitor;
+    unsigned int written = atomic_load_explicit(&ring->written, memory_order_acquire);
+
+    // Frames overwritten before they were read are lost, only the newest ones are still in the ring
+    if (written - monitor->frameRead > LAUNCHER_MONITOR_CAPACITY) monitor->frameRead = written - LAUNCHER_MONITOR_CAPACITY;
+
+    for (; monitor->frameRead != written; monitor->frameRead++) {
+        LauncherMonitorFrame frame = ring->frames[monitor->frameRead%LAUNCHER_MONITOR_CAPACITY];
+
+        // The example may have started to overwrite the slot while it was copied
+        atomic_thread_fence(memory_order_acquire);
+        if (atomic_load_explicit(&ring->written, memory_order_relaxed) - monitor->frameRead >= LAUNCHER_MONITOR_CAPACITY) continue;
+
+        float workTime = frame.updateTime + frame.drawTime;
+        monitor->frameTimes[monitor->frameHead] = frame.frameTime;
+        monitor->workTimes[monitor->frameHead] = workTime;
+        monitor->frameHead = (monitor->frameHead + 1)%MONITOR_FRAME_HISTORY;
+        if (monitor->frameCount < MONITOR_FRAME_HISTORY) monitor->frameCount++;
+
+        int bin = (int)(frame.frameTime*10.0f);
+        if (bin < 0) bin = 0;
+        if (bin >= MONITOR_HISTOGRAM_BINS) bin = MONITOR_HISTOGRAM_BINS - 1;
+        monitor->histogram[bin]++;
+        monitor->frameTotal++;
+        monitor->frameSum += frame.frameTime;
+        monitor->workSum += workTime;
+    }
+}
+
+// Sample the process resources into the sparklines history
+void SampleProcessStats(pid_t pid) {
+    ResourceMonitor* monitor = &resourceMonitor;
+    double now = GetTime();
+    double cpuTime = 0;
+    float rss = 0;
+    int threads = 0;
+
+    double elapsed = now - monitor->sampleTime;
+    monitor->sampleTime = now;
+    if (!ReadProcessStats(pid, &cpuTime, &rss, &threads) || elapsed <= 0) return;
+
+    monitor->cpu[monitor->sampleHead] = (float)(100.0*(cpuTime - monitor->cpuTime)/elapsed);
+    monitor->rss[monitor->sampleHead] = rss;
+    monitor->threads[monitor->sampleHead] = (float)threads;
+    monitor->sampleHead = (monitor->sampleHead + 1)%MONITOR_HISTORY;
+    if (monitor->sampleCount < MONITOR_HISTORY) monitor->sampleCount++;
+
+    monitor->cpuTime = cpuTime;
+    if (rss > monitor->peakRss) monitor->peakRss = rss;
+    if (threads > monitor->peakThreads) monitor->peakThreads = threads;
+
+    RequestRedraw();
+}
+
+// Follow the resources of the running example, called once per frame and never blocks
+void UpdateResourceMonitor() {
+    if (launchStage != LAUNCH_RUNNING) return;
+
+    if (launchProcess.monitor) ReadMonitorFrames(launchProcess.monitor);
+    if (launchProcess.pid > 0 && GetTime() - resourceMonitor.sampleTime >= MONITOR_SAMPLE_INTERVAL) SampleProcessStats(launchProcess.pid);
+}
+
+// Summarize the run that just ended, with the totals of the exited process
+void FinishResourceMonitor(const ChildProcess* process, double runTime, ResourceSummary* summary) {
+    ResourceMonitor* monitor = &resourceMonitor;
+    if (process->monitor) ReadMonitorFrames(process->monitor);
+
+    memset(summary, 0, sizeof(ResourceSummary));
+    summary->valid = true;
+    summary->frames = monitor->frameTotal;
+    summary->peakThreads = monitor->peakThreads;
+
+    if (monitor->frameTotal > 0) {
+        summary->frameAverage = (float)(monitor->frameSum/monitor->frameTotal);
+        summary->workAverage = (float)(monitor->workSum/monitor->frameTotal);
+
+        int target = (int)ceil(0.95*monitor->frameTotal);
+        int bin = 0;
+        for (int count = 0; bin < MONITOR_HISTOGRAM_BINS; bin++) {
+            count += monitor->histogram[bin];
+            if (count >= target) break;
+        }
+        summary->frameP95 = (bin + 1)*0.1f;
+    }
+
+    // The kernel totals also cover the end of the run, after the last sample
+    double cpuTime = process->usage.ru_utime.tv_sec + process->usage.ru_utime.tv_usec*1e-6 + process->usage.ru_stime.tv_sec + process->usage.ru_stime.tv_usec*1e-6;
+    if (cpuTime > monitor->startCpuTime) cpuTime -= monitor->startCpuTime;
+    if (runTime > 0) summary->cpuAverage = (float)(100.0*cpuTime/runTime);
+
+#if defined(__APPLE__)
+    float peakRss = process->usage.ru_maxrss/(1024.0f*1024.0f);     // Bytes on macOS
+#else
+    float peakRss = process->usage.ru_maxrss/1024.0f;               // Kilobytes on Linux
+#endif
+    summary->peakRss = (peakRss > monitor->peakRss) ? peakRss : monitor->peakRss;
+}
+
+// Describe the resources used by a run
+// NOTE: Uses its own buffer, so the result can be passed to TextFormat()
+const char* GetResourceSummaryText(const ResourceSummary* summary) {
+    static char text[160];
+    char frames[64] = "no frame timings";
+
+    if (summary->frames > 0) {
+        snprintf(frames, sizeof(frames), "frame %.1f ms avg, %.1f p95 (work %.1f)", summary->frameAverage, summary->frameP95, summary->workAverage);
+    }
+    snprintf(text, sizeof(text), "%s  |  CPU %.0f%%  |  RSS %.0f MB%s", frames, summary->cpuAverage, summary->peakRss,
+             (summary->peakThreads > 0) ? TextFormat("  |  %d threads", summary->peakThreads) : "");
+
+    return text;
+}
+
+// Largest value of a sparkline history, at least minValue
+float GetHistoryMax(const float* values, int count, float minValue) {
+    float maxValue = minValue;
+    for (int i = 0; i < count; i++) if (values[i] > maxValue) maxValue = values[i];
+    return maxValue;
+}
+
+// Draw the count newest values of a history ring, the newest one on the right edge
+void DrawSparkline(const float* values, int head, int count, int capacity, float maxValue, Rectangle bounds, Color color) {
+    if (count < 2) return;
+
+    float step = bounds.width/(capacity - 1);
+    Vector2 previous = { 0 };
+    for (int i = 0; i < count; i++) {
+        float value = values[(head - count + i + capacity)%capacity];
+        if (value > maxValue) value = maxValue;
+
+        Vector2 point = { bounds.x + bounds.width - (count - 1 - i)*step, bounds.y + bounds.height*(1.0f - value/maxValue) };
+        if (i > 0) DrawLineV(previous, point, color);
+        previous = point;
+    }
+}
+
+// Draw the live resources of the running example: frame time, CPU use, RSS and threads
+void DrawResourceMonitor(int x, int y) {
+    const ResourceMonitor* monitor = &resourceMonitor;
+    const int cellWidth = 130;
+    const int graphWidth = 64;
+    const int graphHeight = 20;
+    int lastSample = (monitor->sampleHead - 1 + MONITOR_HISTORY)%MONITOR_HISTORY;
+    int lastFrame = (monitor->frameHead - 1 + MONITOR_FRAME_HISTORY)%MONITOR_FRAME_HISTORY;
+
+    for (int cell = 0; cell < 4; cell++) {
+        Rectangle bounds = { (float)(x + cell*cellWidth), (float)y, (float)graphWidth, (float)graphHeight };
+        DrawRectangleRec(bounds, (Color){ 60, 60, 60, 255 });
+    }
+
+    // Frame time, with its update and draw part below
+    float frameMax = GetHistoryMax(monitor->frameTimes, monitor->frameCount, 20.0f);
+    DrawSparkline(monitor->workTimes, monitor->frameHead, monitor->frameCount, MONITOR_FRAME_HISTORY, frameMax, (Rectangle){ x, y, graphWidth, graphHeight }, LIME);
+    DrawSparkline(monitor->frameTimes, monitor->frameHead, monitor->frameCount, MONITOR_FRAME_HISTORY, frameMax, (Rectangle){ x, y, graphWidth, graphHeight }, SKYBLUE);
+    DrawText((monitor->frameCount > 0) ? TextFormat("%.1f ms", monitor->frameTimes[lastFrame]) : "-- ms", x + graphWidth + 4, y, 10, WHITE);
+    DrawText("frame", x + graphWidth + 4, y + 10, 10, GRAY);
+
+    x += cellWidth;
+    DrawSparkline(monitor->cpu, monitor->sampleHead, monitor->sampleCount, MONITOR_HISTORY, GetHistoryMax(monitor->cpu, monitor->sampleCount, 100.0f), (Rectangle){ x, y, graphWidth, graphHeight }, ORANGE);
+    DrawText((monitor->sampleCount > 0) ? TextFormat("%.0f%%", monitor->cpu[lastSample]) : "--", x + graphWidth + 4, y, 10, WHITE);
+    DrawText("CPU", x + graphWidth + 4, y + 10, 10, GRAY);
+
+    x += cellWidth;
+    DrawSparkline(monitor->rss, monitor->sampleHead, monitor->sampleCount, MONITOR_HISTORY, GetHistoryMax(monitor->rss, monitor->sampleCount, 1.0f), (Rectangle){ x, y, graphWidth, graphHeight }, PURPLE);
+    DrawText((monitor->sampleCount > 0) ? TextFormat("%.0f MB", monitor->rss[lastSample]) : "-- MB", x + graphWidth + 4, y, 10, WHITE);
+    DrawText("RSS", x + graphWidth + 4, y + 10, 10, GRAY);
+
+    x += cellWidth;
+    DrawSparkline(monitor->threads, monitor->sampleHead, monitor->sampleCount, MONITOR_HISTORY, GetHistoryMax(monitor->threads, monitor->sampleCount, 1.0f), (Rectangle){ x, y, graphWidth, graphHeight }, GOLD);
+    DrawText((monitor->sampleCount > 0) ? TextFormat("%.0f", monitor->threads[lastSample]) : "--", x + graphWidth + 4, y, 10, WHITE);
+    DrawText("threads", x + graphWidth + 4, y + 10, 10, GRAY);
+}
+
+// Build the helper once per raylib configuration and start the warm pool
+void InitWarmLaunching(bool warm) {
+    // Launched examples report their first frame on REPORT_FD and their frame timings on MONITOR_FD
+    char hooksPath[PATH_MAX];
+    if (!realpath(HOOKS_HEADER, hooksPath)) {
+        LogMessage(ORANGE, "Could not find " HOOKS_HEADER ", first frame times and warm launching disabled");
+        return;
+    }
+    snprintf(hooksFlags, sizeof(hooksFlags), "-include %s", hooksPath);
+    snprintf(warmFlags, sizeof(warmFlags), "%s " WARM_EXAMPLE_FLAGS, hooksFlags);
+    setenv("LAUNCHER_FIRST_FRAME_FD", TextFormat("%d", REPORT_FD), 1);
+    setenv("LAUNCHER_MONITOR_FD", TextFormat("%d", MONITOR_FD), 1);
+
+    if (!warm) return;
+    signal(SIGPIPE, SIG_IGN);      // A helper may die before it gets its example
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    hash = HashBytes(hash, compileFlags, strlen(compileFlags));
+    if (!HashFile(&hash, HELPER_SOURCE)) {
+        LogMessage(ORANGE, "Could not find " HELPER_SOURCE ", warm launching disabled");
+        return;
+    }
+    snprintf(helperPath, sizeof(helperPath), CACHE_DIR "/launcher_helper_%016llx", (unsigned long long)hash);
+
+    if (access(helperPath, X_OK) != 0) {
+        mkdir(CACHE_DIR, 0755);
+
+        char command[2048];
+        int commandLength = snprintf(command, sizeof(command), COMPILER " " HELPER_SOURCE " -o %s.tmp %s " HELPER_LIBS " > " CACHE_DIR "/launcher_helper.log 2>&1 && mv -f %s.tmp %s",
+                 helperPath, compileFlags, helperPath, helperPath);
+        if (commandLength >= (int)sizeof(command) || system(command) != 0) {
+            LogMessage(ORANGE, "Could not build the warm helper (see " CACHE_DIR "/launcher_helper.log), warm launching disabled");
+            return;
+        }
+    }
+
+    warmLaunchEnabled = true;
+    RefillWarmPool();
+}
+
+// Stop handing examples to warm helpers, their build variant does not work here
+void DisableWarmLaunching(const char* reason) {
+    pthread_mutex_lock(&buildMutex);
+    warmLaunchEnabled = false;
+    pthread_mutex_unlock(&buildMutex);
+
+    StopWarmPool();
+    LogMessage(ORANGE, TextFormat("Warm launching disabled: %s", reason));
+}
+
+// Check if the failed shared object build of the launch shows errors no example could avoid
+// NOTE: Position independent code and launcher_hooks.h errors come from raylib or the hooks, not from the example
+bool IsWarmBuildBroken() {
+    static const char* markers[] = { "-fPIC", "relocation R_", "recompile with", "launcher_hooks" };
+
+    int first = (launchWarmLogStart > logTotal - logCount) ? launchWarmLogStart : logTotal - logCount;
+    for (int line = first; line < logTotal; line++) {
+        const char* text = logLines[line%LOG_MAX_LINES].text;
+        for (int i = 0; i < (int)(sizeof(markers)/sizeof(markers[0])); i++) {
+            if (strstr(text, markers[i]) != NULL) return true;
+        }
+    }
+
+    return false;
+}
+
+// Handle a regular build that worked after the shared object one failed
+// NOTE: Warm launching is only disabled for every example when the failure is not specific to this one
+void HandleWarmBuildFallback() {
+    if (IsWarmBuildBroken()) {
+        DisableWarmLaunching("examples can not be built as shared objects with this raylib");
+        return;
+    }
+
+    pthread_mutex_lock(&buildMutex);
+    examples[launchIndex].warmUnsupported = true;
+    pthread_mutex_unlock(&buildMutex);
+
+    LogMessage(ORANGE, TextFormat("%s only builds as a regular program, it runs without a warm helper", examples[launchIndex].name));
+}
+
+// Start running the compiled example of the launch in progress
+void StartLaunchRun() {
+    ExampleInfo* example = &examples[launchIndex];
+    example->firstFrameTime = 0;
+    example->lastLaunchWarm = false;
+
+    char workDir[256];
+    snprintf(workDir, sizeof(workDir), "raylib-examples/%s", example->category);
+
+    double handOffTime = GetMonotonicTime();
+    bool started = false;
+
+    if (launchWarm) {
+        // Hand the example over to a warm helper, or to a new one when the pool is empty
+        WarmHelper helper;
+        bool warm = TakeWarmHelper(&helper);
+        if (warm || SpawnWarmHelper(&helper)) {
+            char request[1024];
+            int length = snprintf(request, sizeof(request), "%s\n%s\n", launchBinaryPath, workDir);
+            started = (write(helper.commandFd, request, length) == length);
+            close(helper.commandFd);
+
+            if (started) {
+                launchProcess = helper.process;
+                example->lastLaunchWarm = warm;
+            } else {
+                kill(helper.process.pid, SIGTERM);
+                waitpid(helper.process.pid, NULL, 0);
+                CloseProcessPipes(&helper.process);
+            }
+        }
+    } else {
+        // Run from the example directory, so relative resources paths resolve
+        char command[1024];
+        snprintf(command, sizeof(command), "exec %s", launchBinaryPath);
+        started = SpawnProcess(&launchProcess, workDir, command, true, -1);
+    }
+
+    if (started) {
+        launchStage = LAUNCH_RUNNING;
+        launchStageStartTime = GetTime();
+        launchRunStartTime = handOffTime;
+        launchFirstFrameSeen = false;
+        ResetResourceMonitor(&launchProcess);
+        LogMessage(WHITE, TextFormat("Running %s (pid %d%s)", example->name, (int)launchProcess.pid,
+            example->lastLaunchWarm ? ", warm helper" : launchWarm ? ", new helper" : ""));
+    } else {
+        launchStage = LAUNCH_IDLE;
+        LogMessage(RED, TextFormat("Could not start %s: %s", example->name, strerror(errno)));
+    }
+}
+
+// Compile the example of the launch in progress, with the compiler output streamed into the log panel
+void StartLaunchCompile(const char* flags, double startTime) {
+    mkdir(CACHE_DIR, 0755);
+
+    pthread_mutex_lock(&buildMutex);
+    int tempId = buildTempCounter++;
+    pthread_mutex_unlock(&buildMutex);
+
+    if (launchWarm) launchWarmLogStart = logTotal;
+
+    // Same build steps as BuildExample()
+    char command[2048];
+    int commandLength = snprintf(command, sizeof(command),
+             COMPILER " %s %s.c -o %s.tmp%d %s && mv -f %s.tmp%d %s",
+             flags ? flags : "", examples[launchIndex].name, launchBinaryPath, tempId, compileFlags, launchBinaryPath, tempId, launchBinaryPath);
+
+    char workDir[256];
+    snprintf(workDir, sizeof(workDir), "raylib-examples/%s", examples[launchIndex].category);
+
+    if (commandLength >= (int)sizeof(command)) {
+        launchStage = LAUNCH_IDLE;
+        LogMessage(RED, "Could not start the compiler: build command too long");
+    } else if (SpawnProcess(&launchProcess, workDir, command, false, -1)) {
+        launchStage = LAUNCH_COMPILING;
+        launchStageStartTime = startTime;
+    } else {
+        launchStage = LAUNCH_IDLE;
+        LogMessage(RED, TextFormat("Could not start the compiler: %s", strerror(errno)));
+    }
+}
+
+// Compile and run an example in the background, reusing the cached binary when nothing changed
+void CompileAndRunExample(int index) {
+    if (index < 0 || index >= exampleCount) return;
+    if (launchStage != LAUNCH_IDLE) {
+        LogMessage(ORANGE, TextFormat("%s is still %s, close it first", examples[launchIndex].name,
+            (launchStage == LAUNCH_COMPILING) ? "compiling" : "running"));
+        return;
+    }
+
+    double startTime = GetTime();
+    const char* flags = GetLaunchFlags(index, &launchWarm);
+    bool cached = GetCachedBinaryPath(index, flags, launchBinaryPath, sizeof(launchBinaryPath));
+    examples[index].lastLaunchCached = cached;
+    launchIndex = index;
+    launchFallback = false;
+    logPanelVisible = true;
+    logScroll = 0;
+
+    LogMessage(SKYBLUE, "==============================================");
+    LogMessage(SKYBLUE, TextFormat("%s: %s  |  Category: %s  |  Difficulty: %s", cached ? "Cached" : "Compiling",
+        examples[index].name, examples[index].category, examples[index].difficulty));
+
+    if (cached) {
+        cacheHits++;
+        examples[index].compileTime = 0;
+        StartLaunchRun();
+        lastLaunchTime = (GetTime() - startTime)*1000.0;
+        return;
+    }
+
+    cacheMisses++;
+    StartLaunchCompile(flags, startTime);
+}
+
+// Read the first frame report of the running example, sent by launcher_hooks.h
+void ReadFirstFrameReport() {
+    if (launchProcess.reportFd < 0) return;
+
+    char report[64];
+    ssize_t length = read(launchProcess.reportFd, report, sizeof(report) - 1);
+    if (length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)) return;
+
+    // Without a report the example closed without drawing any frame
+    if (length > 0) {
+        ExampleInfo* example = &examples[launchIndex];
+        report[length] = '\0';
+        example->firstFrameTime = (atof(report) - launchRunStartTime)*1000.0;
+        LogMessage(SKYBLUE, TextFormat("First frame after %.0f ms (%s)", example->firstFrameTime,
+            example->lastLaunchWarm ? "warm helper" : launchWarm ? "new helper" : "cold start"));
+    }
+
+    close(launchProcess.reportFd);
+    launchProcess.reportFd = -1;
+    launchFirstFrameSeen = true;
+}
+
+// Advance the launch in progress, called once per frame and never blocks
+void UpdateLaunch() {
+    if (launchStage == LAUNCH_IDLE) return;
+
+    if (launchStage == LAUNCH_RUNNING && !launchFirstFrameSeen) ReadFirstFrameReport();
+
+    int status = 0;
+    if (!PollProcess(&launchProcess, &status)) return;
+
+    ExampleInfo* example = &examples[launchIndex];
+    double elapsed = GetTime() - launchStageStartTime;
+
+    if (launchStage == LAUNCH_RUNNING) {
+        if (!launchFirstFrameSeen) ReadFirstFrameReport();
+        FinishResourceMonitor(&launchProcess, elapsed, &example->resources);
+    }
+    CloseProcessPipes(&launchProcess);
+
+    if (launchStage == LAUNCH_COMPILING) {
+        example->compileTime = elapsed*1000.0;
+
+        if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+            SetBuildState(launchIndex, BUILD_READY);
+            LogMessage(LIME, TextFormat("Compiled in %.0f ms", example->compileTime));
+            lastLaunchTime = example->compileTime;
+            if (launchFallback) HandleWarmBuildFallback();
+            StartLaunchRun();
+        } else if (launchWarm) {
+            // raylib may be a static library built without -fPIC, try a regular build
+            LogMessage(ORANGE, "Could not build it as a shared object for a warm helper, trying a regular build");
+            const char* flags = (hooksFlags[0] != '\0') ? hooksFlags : NULL;
+            launchWarm = false;
+            launchFallback = true;
+            if (GetCachedBinaryPath(launchIndex, flags, launchBinaryPath, sizeof(launchBinaryPath))) {
+                HandleWarmBuildFallback();
+                StartLaunchRun();
+            } else {
+                StartLaunchCompile(flags, GetTime());
+            }
+        } else {
+            SetBuildState(launchIndex, BUILD_FAILED);
+            example->exitStatus = status;
+            LogMessage(RED, TextFormat("❌ Compilation failed (%s) after %.0f ms", GetExitStatusText(status), example->compileTime));
+            LogMessage(RED, "Make sure raylib is installed: brew install raylib");
+            launchStage = LAUNCH_IDLE;
+        }
+    } else {
+        example->runTime = elapsed;
+        example->exitStatus = status;
+        bool success = WIFEXITED(status) && (WEXITSTATUS(status) == 0);
+        LogMessage(success ? LIME : RED, TextFormat("%s %s finished (%s) after %.2f s", success ? "✅" : "❌",
+            example->name, GetExitStatusText(status), example->runTime));
+        LogMessage(SKYBLUE, TextFormat("Resources: %s", GetResourceSummaryText(&example->resources)));
+        launchStage = LAUNCH_IDLE;
+    }
+}
+
+// Stop the launch in progress, used on exit
+void StopLaunch() {
+    if (launchStage == LAUNCH_IDLE) return;
+
+    if (launchProcess.pid > 0) {
+        kill(launchProcess.pid, SIGTERM);
+        waitpid(launchProcess.pid, NULL, 0);
+    }
+    CloseProcessPipes(&launchProcess);
+    launchStage = LAUNCH_IDLE;
+}
+
+// Draw the log panel with the newest lines at the bottom
+void DrawLogPanel(int x, int y, int width, int height) {
+    int lineHeight = 14;
+    int visibleLines = (height - 30)/lineHeight;
+
+    DrawRectangle(x, y, width, height, (Color){ 30, 30, 30, 255 });
+    DrawRectangle(x, y, width, 22, (Color){ 50, 50, 50, 255 });
+
+    const char* status = "idle";
+    if (launchStage == LAUNCH_COMPILING) status = TextFormat("compiling %s... %.1f s", examples[launchIndex].name, GetTime() - launchStageStartTime);
+    else if (launchStage == LAUNCH_RUNNING) status = TextFormat("running %s... %.1f s", examples[launchIndex].name, GetTime() - launchStageStartTime);
+    DrawText(TextFormat("OUTPUT  (%s)  |  L to hide, wheel to scroll", status), x + 8, y + 5, 12, LIGHTGRAY);
+
+    if (logScroll > logCount - visibleLines) logScroll = logCount - visibleLines;
+    if (logScroll < 0) logScroll = 0;
+
+    int shown = (logCount < visibleLines) ? logCount : visibleLines;
+    for (int i = 0; i < shown; i++) {
+        // Line i of the window, counting back from the newest line
+        int age = logScroll + shown - 1 - i;
+        int line = (logHead - 1 - age + LOG_MAX_LINES)%LOG_MAX_LINES;
+        DrawText(logLines[line].text, x + 8, y + 28 + i*lineHeight, 10, logLines[line].color);
+    }
+}
+
+// Previous filtering implementation, rescanning the catalog with string compares (kept for --bench-index)
+int LegacyGetRealIndexFromFiltered(int tab, int filteredIndex) {
+    if (tab == 0) return filteredIndex;
+
+    int count = 0;
+    for (int i = 0; i < exampleCount; i++) {
+        if (GetTabIndexFromCategory(examples[i].category) == tab) {
+            if (count == filteredIndex) return i;
+            count++;
+        }
+    }
+    return 0;
+}
+
+// Per frame filtering work of the previous DrawExampleList(), returns a checksum so it is not optimized out
+long LegacyListFrame(int tab, int selected, int visibleItems) {
+    long checksum = 0;
+    int displayIndex = 0;
+
+    for (int i = 0; i < exampleCount; i++) {
+        if (tab != 0 && GetTabIndexFromCategory(examples[i].category) != tab) continue;
+        if (displayIndex < selected || displayIndex >= selected + visibleItems) {
+            displayIndex++;
+            continue;
+        }
+
+        // Row background and row text color both looked up the selected example
+        checksum += (i == LegacyGetRealIndexFromFiltered(tab, selected));
+        checksum += (i == LegacyGetRealIndexFromFiltered(tab, selected)) + i;
+        displayIndex++;
+    }
+
+    return checksum;
+}
+
+// Per frame filtering work of the indexed DrawExampleList()
+long IndexedListFrame(int tab, int selected, int visibleItems) {
+    activeTab = tab;
+    long checksum = 0;
+    int selectedIndex = GetRealIndexFromFiltered(selected);
+    int lastVisible = selected + visibleItems;
+    if (lastVisible > GetFilteredExampleCount()) lastVisible = GetFilteredExampleCount();
+
+    for (int displayIndex = selected; displayIndex < lastVisible; displayIndex++) {
+        int i = GetRealIndexFromFiltered(displayIndex);
+        checksum += 2*(i == selectedIndex) + i;
+    }
+
+    return checksum;
+}
+
+// Average time of a list frame (us), repeated until the measure is long enough
+double MeasureListFrame(long (*frame)(int, int, int), long* checksum) {
+    int iterations = 0;
+    double start = GetMonotonicTime();
+    double elapsed = 0;
+
+    do {
+        for (int tab = 0; tab < TAB_COUNT; tab++) {
+            *checksum += frame(tab, tabs[tab].count/2, 16);
+        }
+        iterations++;
+        elapsed = GetMonotonicTime() - start;
+    } while (elapsed < 0.25 || iterations < 3);
+
+    return elapsed*1e6/(iterations*TAB_COUNT);
+}
+
+// Microbenchmark of the tab filtering: legacy scans vs precomputed tab index, on synthetic catalogs
+void RunIndexBenchmark(int maxEntries) {
+    const char* categories[] = { "core", "shapes", "textures", "text", "models", "shaders", "audio" };
+    int sizes[] = { 182, 1000, 10000, maxEntries };
+
+    printf("%10s %18s %18s %10s\n", "entries", "legacy us/frame", "indexed us/frame", "speedup");
+
+    for (int s = 0; s < 4; s++) {
+        if (s > 0 && sizes[s] <= sizes[s - 1]) continue;
+
+        // Catalog grouped by category, as examples_list.txt is
+        ClearExamples();
+        for (int i = 0; i < sizes[s]; i++) {
+            AddExample(categories[(long)i*7/sizes[s]], TextFormat("example_%06d", i), "★☆☆☆");
+        }
+        BuildTabIndex();
+
+        // Both implementations must agree on every row of every tab
+        for (int tab = 0; (tab < TAB_COUNT) && (sizes[s] <= 10000); tab++) {
+            activeTab = tab;
+            for (int row = 0; row < tabs[tab].count; row++) {
+                if (GetRealIndexFromFiltered(row) != LegacyGetRealIndexFromFiltered(tab, row)) {
+                    printf("Mismatch at tab %d row %d\n", tab, row);
+                    return;
+                }
+            }
+        }
+
+        long legacyChecksum = 0, indexedChecksum = 0;
+        double legacyTime = MeasureListFrame(LegacyListFrame, &legacyChecksum);
+        double indexedTime = MeasureListFrame(IndexedListFrame, &indexedChecksum);
+
+        printf("%10d %18.2f %18.3f %9.0fx%s\n", sizes[s], legacyTime, indexedTime,
+               (indexedTime > 0) ? legacyTime/indexedTime : 0.0, (legacyChecksum > 0 && indexedChecksum > 0) ? "" : " (empty)");
+    }
+
+    ClearExamples();
+    activeTab = 0;
+}
+
+int CompareFloat(const void* a, const void* b) {
+    float x = *(const float*)a, y = *(const float*)b;
+    return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted values
+double GetPercentile(const float* sorted, int count, double percentile) {
+    if (count == 0) return 0;
+
+    int rank = (int)(percentile/100.0*count + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > count) rank = count;
+    return sorted[rank - 1];
+}
+
+// Read the frame times written by the hooks and compute the statistics
+bool LoadBenchOutput(const char* path, double spawnTime, BenchResult* result) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) return false;
+
+    double firstFrame = 0;
+    if (fscanf(fp, "first_frame %lf", &firstFrame) != 1) {
+        fclose(fp);
+        return false;
+    }
+
+    int capacity = 1024;
+    float* frameTimes = (float*)malloc(capacity*sizeof(float));
+    int count = 0;
+    float frameTime = 0;
+    bool firstSkipped = false;
+
+    while (fscanf(fp, "%f", &frameTime) == 1) {
+        // First frame includes the example initialization, it is part of the startup time instead
+        if (!firstSkipped) { firstSkipped = true; continue; }
+        if (count == capacity) {
+            capacity *= 2;
+            frameTimes = (float*)realloc(frameTimes, capacity*sizeof(float));
+        }
+        frameTimes[count++] = frameTime;
+    }
+    fclose(fp);
+
+    result->frameTimes = frameTimes;
+    result->frameCount = count;
+    result->startupTime = (firstFrame - spawnTime)*1000.0;
+
+    float* sorted = (float*)malloc((count + 1)*sizeof(float));
+    memcpy(sorted, frameTimes, count*sizeof(float));
+    qsort(sorted, count, sizeof(float), CompareFloat);
+    result->p50 = GetPercentile(sorted, count, 50);
+    result->p95 = GetPercentile(sorted, count, 95);
+    result->p99 = GetPercentile(sorted, count, 99);
+    result->max = (count > 0) ? sorted[count - 1] : 0;
+    free(sorted);
+
+    return true;
+}
+
+// Run a benchmark build of an example until it completes its frames or times out
+void RunBenchmarkProcess(int index, const char* binaryPath, const BenchOptions* options, BenchResult* result) {
+    char outputPath[512], logPath[512], frames[32];
+    snprintf(outputPath, sizeof(outputPath), CACHE_DIR "/%s.frames", examples[index].name);
+    snprintf(logPath, sizeof(logPath), CACHE_DIR "/%s.bench.log", examples[index].name);
+    snprintf(frames, sizeof(frames), "%d", options->frames);
+    remove(outputPath);
+
+    // The launcher is single threaded in benchmark mode, the environment is inherited by the child
+    setenv("LAUNCHER_BENCH_FRAMES", frames, 1);
+    setenv("LAUNCHER_BENCH_OUTPUT", outputPath, 1);
+
+    char workDir[256];
+    snprintf(workDir, sizeof(workDir), "raylib-examples/%s", examples[index].category);
+    int logFd = open(logPath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    double spawnTime = GetMonotonicTime();
+    pid_t pid = fork();
+    if (pid == 0) {
+        if (logFd >= 0) {
+            dup2(logFd, STDOUT_FILENO);
+            dup2(logFd, STDERR_FILENO);
+        }
+        if (chdir(workDir) != 0) _exit(127);
+        execl(binaryPath, binaryPath, (char*)NULL);
+        _exit(127);
+    }
+    if (logFd >= 0) close(logFd);
+
+    if (pid < 0) {
+        snprintf(result->status, sizeof(result->status), "spawn failed");
+        return;
+    }
+
+    int status = 0;
+    struct rusage usage = { 0 };
+    bool timedOut = false;
+
+    for (;;) {
+        pid_t waited = wait4(pid, &status, timedOut ? 0 : WNOHANG, &usage);
+        if (waited == pid) break;
+        if (waited < 0 && errno == EINTR) continue;
+        if (waited < 0) {
+            // The child can not be waited for, its status and usage are not valid
+            int error = errno;
+            kill(pid, SIGKILL);
+            result->completed = false;
+            snprintf(result->status, sizeof(result->status), "wait failed (%s)", strerror(error));
+            return;
+        }
+
+        if (!timedOut && GetMonotonicTime() - spawnTime > options->timeout) {
+            kill(pid, SIGKILL);
+            timedOut = true;        // Next wait blocks until the killed child is reaped
+        } else usleep(2000);
+    }
+
+#if defined(__APPLE__)
+    result->peakRss = usage.ru_maxrss/1024;     // Bytes on macOS
+#else
+    result->peakRss = usage.ru_maxrss;          // Kilobytes on Linux
+#endif
+
+    result->completed = !timedOut && LoadBenchOutput(outputPath, spawnTime, result);
+    if (timedOut) snprintf(result->status, sizeof(result->status), "timeout");
+    else if (!result->completed) snprintf(result->status, sizeof(result->status), "no frames (%s)", GetExitStatusText(status));
+    else snprintf(result->status, sizeof(result->status), "ok");
+}
+
+// Write benchmark results as JSON when the path ends with .json, CSV otherwise
+bool WriteBenchResults(const char* path, const BenchResult* results, int count, const BenchOptions* options) {
+    FILE* fp = fopen(path, "w");
+    if (!fp) return false;
+
+    size_t length = strlen(path);
+    bool json = (length > 5) && (strcmp(path + length - 5, ".json") == 0);
+
+    if (json) {
+        fprintf(fp, "{\n  \"frames\": %d,\n  \"input\": \"%s\",\n  \"results\": [\n", options->frames, options->inputPath ? options->inputPath : "");
+        for (int i = 0; i < count; i++) {
+            const BenchResult* r = &results[i];
+            fprintf(fp, "    { \"example\": \"%s\", \"category\": \"%s\", \"status\": \"%s\", \"frames\": %d, "
+                        "\"p50_ms\": %.4f, \"p95_ms\": %.4f, \"p99_ms\": %.4f, \"max_ms\": %.4f, "
+                        "\"startup_ms\": %.2f, \"peak_rss_kb\": %ld }%s\n",
+                    examples[r->exampleIndex].name, examples[r->exampleIndex].category, r->status, r->frameCount,
+                    r->p50, r->p95, r->p99, r->max, r->startupTime, r->peakRss, (i < count - 1) ? "," : "");
+        }
+        fprintf(fp, "  ]\n}\n");
+    } else {
+        fprintf(fp, "example,category,status,frames,p50_ms,p95_ms,p99_ms,max_ms,startup_ms,peak_rss_kb\n");
+        for (int i = 0; i < count; i++) {
+            const BenchResult* r = &results[i];
+            fprintf(fp, "%s,%s,%s,%d,%.4f,%.4f,%.4f,%.4f,%.2f,%ld\n",
+                    examples[r->exampleIndex].name, examples[r->exampleIndex].category, r->status, r->frameCount,
+                    r->p50, r->p95, r->p99, r->max, r->startupTime, r->peakRss);
+        }
+    }
+
+    fclose(fp);
+    return true;
 }
 
-// Get tab index from category name
-int GetTabIndexFromCategory(const char* category) {
-    if (strcmp(category, "core") == 0) return 1;
-    if (strcmp(category, "shapes") == 0) return 2;
-    if (strcmp(category, "textures") == 0) return 3;
-    if (strcmp(category, "text") == 0) return 4;
-    if (strcmp(category, "models") == 0) return 5;
-    if (strcmp(category, "shaders") == 0) return 6;
-    if (strcmp(category, "audio") == 0) return 7;
-    return 0;
+// Run a command and return the first line of its output, empty if it fails
+void GetCommandOutput(const char* command, char* output, int size) {
+    output[0] = '\0';
+
+    FILE* pipe = popen(command, "r");
+    if (!pipe) return;
+    if (!fgets(output, size, pipe)) output[0] = '\0';
+    pclose(pipe);
+
+    output[strcspn(output, "\r\n")] = '\0';
 }
 
-// Load all examples from the examples list
-void LoadExamplesList() {
-    FILE* fp = fopen("raylib-examples/examples_list.txt", "r");
-    if (!fp) {
-        printf("Could not open examples_list.txt\n");
+// Current git revision, marked dirty when the tree has local changes
+void GetGitRevision(char* rev, int size) {
+    GetCommandOutput("git rev-parse --short HEAD 2>/dev/null", rev, size);
+    if (rev[0] == '\0') {
+        snprintf(rev, size, "unknown");
         return;
     }
 
-    char line[512];
-    while (fgets(line, sizeof(line), fp) && exampleCount < MAX_EXAMPLES) {
-        // Skip empty lines and comments
-        if (line[0] == '\n' || line[0] == '#') continue;
+    char changes[8];
+    GetCommandOutput("git status --porcelain --untracked-files=no 2>/dev/null | head -1", changes, sizeof(changes));
+    if (changes[0] != '\0') strncat(rev, "-dirty", size - strlen(rev) - 1);
+}
 
-        // Parse the line format: "category;example_name;stars;..."
-        char category[32] = {0};
-        char filename[128] = {0};
-        char stars[16] = {0};
+// Runs are only comparable with the same build flags, frame count and input
+uint64_t GetBenchConfigKey(const BenchOptions* options) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    const char* input = options->inputPath ? options->inputPath : "";
+    hash = HashBytes(hash, compileFlags, strlen(compileFlags));
+    hash = HashBytes(hash, &options->frames, sizeof(options->frames));
+    hash = HashBytes(hash, input, strlen(input));
+    hash = HashBytes(hash, &options->softwareGL, sizeof(options->softwareGL));
+    return hash;
+}
 
-        // Use strtok to parse semicolon-separated values
-        char* token = strtok(line, ";");
-        if (token) {
-            strncpy(category, token, 31);
+// Store a benchmark run with the frame times of every example, returns false if it could not be written
+bool SaveBenchRun(const char* path, const char* rev, uint64_t config, const BenchResult* results, int count) {
+    mkdir(BENCH_HISTORY_DIR, 0755);
 
-            token = strtok(NULL, ";");
-            if (token) {
-                strncpy(filename, token, 127);
+    FILE* fp = fopen(path, "w");
+    if (!fp) return false;
 
-                token = strtok(NULL, ";");
-                if (token) {
-                    strncpy(stars, token, 15);
-                }
-            }
-        }
+    fprintf(fp, "rev %s\nconfig %016llx\ntimestamp %lld\n", rev, (unsigned long long)config, (long long)time(NULL));
+    for (int i = 0; i < count; i++) {
+        const BenchResult* r = &results[i];
 
-        // Skip if parsing failed or not a main category
-        if (strlen(category) == 0 || strlen(filename) == 0) continue;
+        // Long runs are downsampled evenly, the distribution is what matters
+        int samples = (r->frameCount < BENCH_MAX_SAMPLES) ? r->frameCount : BENCH_MAX_SAMPLES;
+        fprintf(fp, "result %s %d %.3f %.4f %.4f %.4f %.4f %ld %d", examples[r->exampleIndex].name, r->completed ? 1 : 0,
+                r->startupTime, r->p50, r->p95, r->p99, r->max, r->peakRss, samples);
+        for (int s = 0; s < samples; s++) fprintf(fp, " %.4f", r->frameTimes[(long)s*r->frameCount/samples]);
+        fprintf(fp, "\n");
+    }
 
-        if (strcmp(category, "core") != 0 &&
-            strcmp(category, "shapes") != 0 &&
-            strcmp(category, "textures") != 0 &&
-            strcmp(category, "text") != 0 &&
-            strcmp(category, "models") != 0 &&
-            strcmp(category, "shaders") != 0 &&
-            strcmp(category, "audio") != 0) continue;
-
-        // Store example info
-        snprintf(examples[exampleCount].name, MAX_NAME_LENGTH, "%s", filename);
-        snprintf(examples[exampleCount].category, 32, "%s", category);
-        snprintf(examples[exampleCount].filepath, 256, "raylib-examples/%s/%s.c", category, filename);
-
-        // Convert star symbols
-        if (strlen(stars) > 0) {
-            strncpy(examples[exampleCount].difficulty, stars, 15);
-        } else {
-            strcpy(examples[exampleCount].difficulty, "★☆☆☆");
-        }
+    fclose(fp);
+    return true;
+}
+
+// Load a stored run, header only when withResults is false
+bool LoadBenchRun(const char* path, bool withResults, BenchRun* run) {
+    FILE* fp = fopen(path, "r");
+    if (!fp) return false;
+
+    memset(run, 0, sizeof(BenchRun));
+    snprintf(run->path, sizeof(run->path), "%s", path);
+
+    unsigned long long config = 0;
+    bool valid = (fscanf(fp, "rev %63s\nconfig %llx\ntimestamp %lld\n", run->rev, &config, &run->timestamp) == 3);
+    run->config = config;
 
-        // Count examples per category
-        int tabIndex = GetTabIndexFromCategory(category);
-        tabs[tabIndex].count++;
-        tabs[0].count++; // All
+    int capacity = 0;
+    while (valid && withResults) {
+        char name[MAX_NAME_LENGTH];
+        int completed = 0, samples = 0;
+        BenchResult result = { 0 };
 
-        exampleCount++;
+        if (fscanf(fp, " result %127s %d %lf %lf %lf %lf %lf %ld %d", name, &completed, &result.startupTime,
+                   &result.p50, &result.p95, &result.p99, &result.max, &result.peakRss, &samples) != 9) break;
+
+        result.completed = (completed != 0);
+        result.frameCount = (samples > 0) ? samples : 0;
+        result.frameTimes = (float*)malloc((result.frameCount + 1)*sizeof(float));
+        for (int s = 0; s < result.frameCount; s++) {
+            if (fscanf(fp, "%f", &result.frameTimes[s]) != 1) { result.frameCount = s; break; }
+        }
+
+        if (run->resultCount == capacity) {
+            capacity = (capacity == 0) ? 256 : capacity*2;
+            run->results = (BenchResult*)realloc(run->results, capacity*sizeof(BenchResult));
+            run->names = (char (*)[MAX_NAME_LENGTH])realloc(run->names, capacity*MAX_NAME_LENGTH);
+        }
+        run->results[run->resultCount] = result;
+        snprintf(run->names[run->resultCount], MAX_NAME_LENGTH, "%s", name);
+        run->resultCount++;
     }
 
     fclose(fp);
-    printf("Loaded %d examples\n", exampleCount);
+    return valid;
 }
 
-// Get filtered example index (accounting for active tab filter)
-int GetFilteredExampleCount() {
-    if (activeTab == 0) return exampleCount;
+void UnloadBenchRun(BenchRun* run) {
+    for (int i = 0; i < run->resultCount; i++) free(run->results[i].frameTimes);
+    free(run->results);
+    free(run->names);
+    memset(run, 0, sizeof(BenchRun));
+}
 
-    int count = 0;
-    for (int i = 0; i < exampleCount; i++) {
-        if (GetTabIndexFromCategory(examples[i].category) == activeTab) {
-            count++;
-        }
+// Find the result of an example in a stored run
+const BenchResult* FindBenchRunResult(const BenchRun* run, const char* name) {
+    for (int i = 0; i < run->resultCount; i++) {
+        if (strcmp(run->names[i], name) == 0) return &run->results[i];
     }
-    return count;
+    return NULL;
 }
 
-// Get real index from filtered index
-int GetRealIndexFromFiltered(int filteredIndex) {
-    if (activeTab == 0) return filteredIndex;
+int CompareBenchRunsNewestFirst(const void* a, const void* b) {
+    long long x = ((const BenchRun*)a)->timestamp, y = ((const BenchRun*)b)->timestamp;
+    if (x != y) return (x < y) - (x > y);
+    return -strcmp(((const BenchRun*)a)->path, ((const BenchRun*)b)->path);
+}
 
-    int count = 0;
-    for (int i = 0; i < exampleCount; i++) {
-        if (GetTabIndexFromCategory(examples[i].category) == activeTab) {
-            if (count == filteredIndex) return i;
-            count++;
+// Load the baseline runs: same configuration, the requested revision (any when NULL), newest first
+int LoadBaselineRuns(uint64_t config, const char* rev, const char* excludePath, BenchRun* runs, int maxRuns) {
+    DIR* dir = opendir(BENCH_HISTORY_DIR);
+    if (!dir) return 0;
+
+    int capacity = 64, count = 0;
+    BenchRun* headers = (BenchRun*)malloc(capacity*sizeof(BenchRun));
+
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL) {
+        size_t length = strlen(entry->d_name);
+        if (length < 5 || strcmp(entry->d_name + length - 4, ".run") != 0) continue;
+
+        char path[512];
+        snprintf(path, sizeof(path), BENCH_HISTORY_DIR "/%s", entry->d_name);
+        if (excludePath && strcmp(path, excludePath) == 0) continue;
+
+        BenchRun header;
+        if (!LoadBenchRun(path, false, &header)) continue;
+        if (header.config != config || (rev && strcmp(header.rev, rev) != 0)) continue;
+
+        if (count == capacity) {
+            capacity *= 2;
+            headers = (BenchRun*)realloc(headers, capacity*sizeof(BenchRun));
         }
+        headers[count++] = header;
     }
-    return 0;
+    closedir(dir);
+
+    qsort(headers, count, sizeof(BenchRun), CompareBenchRunsNewestFirst);
+
+    int loaded = 0;
+    for (int i = 0; i < count && loaded < maxRuns; i++) {
+        if (LoadBenchRun(headers[i].path, true, &runs[loaded])) loaded++;
+    }
+    free(headers);
+
+    return loaded;
 }
 
-// Get filtered index from real index
-int GetFilteredIndexFromReal(int realIndex) {
-    if (activeTab == 0) return realIndex;
+typedef struct {
+    float value;
+    int group;      // 0 = baseline, 1 = new run
+} RankedSample;
 
-    int count = 0;
-    for (int i = 0; i <= realIndex && i < exampleCount; i++) {
-        if (GetTabIndexFromCategory(examples[i].category) == activeTab) {
-            if (i == realIndex) return count;
-            count++;
-        }
+int CompareRankedSamples(const void* a, const void* b) {
+    float x = ((const RankedSample*)a)->value, y = ((const RankedSample*)b)->value;
+    return (x > y) - (x < y);
+}
+
+// One-sided Mann-Whitney U test: p-value of the new samples being stochastically larger than the baseline ones
+// NOTE: Normal approximation with tie correction, fine for the hundreds of frames of a benchmark run
+double MannWhitneyGreaterPValue(const float* baseline, int baselineCount, const float* current, int currentCount) {
+    if (baselineCount < 8 || currentCount < 8) return 1.0;
+
+    int total = baselineCount + currentCount;
+    RankedSample* samples = (RankedSample*)malloc(total*sizeof(RankedSample));
+    for (int i = 0; i < baselineCount; i++) samples[i] = (RankedSample){ baseline[i], 0 };
+    for (int i = 0; i < currentCount; i++) samples[baselineCount + i] = (RankedSample){ current[i], 1 };
+    qsort(samples, total, sizeof(RankedSample), CompareRankedSamples);
+
+    // Rank sum of the new samples, ties get their average rank
+    double rankSum = 0, tieCorrection = 0;
+    for (int i = 0; i < total; ) {
+        int j = i;
+        while (j + 1 < total && samples[j + 1].value == samples[i].value) j++;
+
+        double averageRank = (i + j)/2.0 + 1.0;
+        int ties = j - i + 1;
+        for (int k = i; k <= j; k++) if (samples[k].group == 1) rankSum += averageRank;
+        tieCorrection += (double)ties*ties*ties - ties;
+        i = j + 1;
     }
-    return 0;
+    free(samples);
+
+    double n1 = currentCount, n2 = baselineCount, n = total;
+    double u = rankSum - n1*(n1 + 1)/2.0;
+    double mean = n1*n2/2.0;
+    double variance = n1*n2/12.0*((n + 1) - tieCorrection/(n*(n - 1)));
+    if (variance <= 0) return 1.0;
+
+    double z = (u - mean - 0.5)/sqrt(variance);     // Continuity correction
+    return 0.5*erfc(z/sqrt(2.0));
 }
 
-// Draw tabs at the top
-void DrawTabs(int screenWidth) {
-    int tabWidth = screenWidth / TAB_COUNT;
-    int tabHeight = 50;
+// Compare a run against the baseline runs and write the regression report, returns the regressions count
+int CompareWithBaseline(const BenchResult* results, int count, const BenchRun* baselines, int baselineCount,
+                        const char* rev, const BenchOptions* options) {
+    FILE* fp = fopen(BENCH_REGRESSION_REPORT, "w");
+    if (fp) fprintf(fp, "# baseline %s -> %s\n", baselineCount > 0 ? baselines[0].rev : "none", rev);
 
-    for (int i = 0; i < TAB_COUNT; i++) {
-        int x = i * tabWidth;
+    int regressions = 0;
+    printf("\nRegressions against %s (threshold %.0f%%, p < %.2f):\n", (baselineCount > 0) ? baselines[0].rev : "no baseline",
+           options->threshold*100.0, BENCH_SIGNIFICANCE);
 
-        // Tab background
-        Color bgColor = (i == activeTab) ? tabs[i].color : Fade(tabs[i].color, 0.3f);
-        DrawRectangle(x, 0, tabWidth - 2, tabHeight, bgColor);
+    for (int i = 0; (i < count) && (baselineCount > 0); i++) {
+        const BenchResult* current = &results[i];
+        const char* name = examples[current->exampleIndex].name;
+        const BenchResult* base = FindBenchRunResult(&baselines[0], name);
+        if (!current->completed || !base || !base->completed) continue;
 
-        // Tab border
-        if (i == activeTab) {
-            DrawRectangleLinesEx((Rectangle){x, 0, tabWidth - 2, tabHeight}, 3, WHITE);
+        // p95 frame time: larger than the threshold and the whole distribution significantly slower
+        double pValue = MannWhitneyGreaterPValue(base->frameTimes, base->frameCount, current->frameTimes, current->frameCount);
+        bool frameRegressed = (current->p95 > base->p95*(1.0 + options->threshold)) &&
+                              (current->p95 - base->p95 > 0.05) && (pValue < BENCH_SIGNIFICANCE);
+
+        // Startup time: one sample per run, the noise is estimated from the previous baseline runs
+        double mean = 0, variance = 0;
+        int startupCount = 0;
+        for (int r = 0; r < baselineCount; r++) {
+            const BenchResult* previous = FindBenchRunResult(&baselines[r], name);
+            if (!previous || !previous->completed) continue;
+            mean += previous->startupTime;
+            startupCount++;
         }
+        mean /= startupCount;
+        for (int r = 0; r < baselineCount; r++) {
+            const BenchResult* previous = FindBenchRunResult(&baselines[r], name);
+            if (previous && previous->completed) variance += (previous->startupTime - mean)*(previous->startupTime - mean);
+        }
+        double deviation = (startupCount > 1) ? sqrt(variance/(startupCount - 1)) : 0.0;
+        double startupDelta = current->startupTime - mean;
+        bool startupRegressed = (startupDelta > mean*options->threshold) && (startupDelta > 3.0*deviation) && (startupDelta > 5.0);
 
-        // Tab text
-        const char* tabText = TextFormat("%s (%d)", tabs[i].name, tabs[i].count);
-        int textWidth = MeasureText(tabText, 18);
-        Color textColor = (i == activeTab) ? WHITE : LIGHTGRAY;
-        DrawText(tabText, x + (tabWidth - textWidth) / 2, 16, 18, textColor);
+        if (!frameRegressed && !startupRegressed) continue;
+        regressions++;
+
+        char text[160];
+        snprintf(text, sizeof(text), "p95 %.2f -> %.2f ms (%+.0f%%, p=%.4f)  |  startup %.0f -> %.0f ms (%+.0f%%)%s%s",
+                 base->p95, current->p95, (base->p95 > 0) ? (current->p95/base->p95 - 1.0)*100.0 : 0.0, pValue,
+                 mean, current->startupTime, (mean > 0) ? (startupDelta/mean)*100.0 : 0.0,
+                 frameRegressed ? "  [frame time]" : "", startupRegressed ? "  [startup]" : "");
+        printf("  %-40s %s\n", name, text);
+        if (fp) fprintf(fp, "%s\t%s\n", name, text);
     }
+
+    if (regressions == 0) printf("  none\n");
+    if (fp) fclose(fp);
+
+    return regressions;
 }
 
-// Draw the example list
-void DrawExampleList(int screenWidth, int screenHeight) {
-    int tabHeight = 50;
-    int listY = tabHeight + 10;
-    int itemHeight = 40;
-    int footerHeight = 120;
-    int visibleHeight = screenHeight - listY - footerHeight;
-    maxVisibleItems = visibleHeight / itemHeight;
+// Load the last regression report into the examples, for the regressions view
+void LoadRegressionReport() {
+    FILE* fp = fopen(BENCH_REGRESSION_REPORT, "r");
+    if (!fp) return;
 
-    int filteredCount = GetFilteredExampleCount();
+    regressionExamples = (int*)realloc(regressionExamples, (exampleCount + 1)*sizeof(int));
+    regressionCount = 0;
 
-    // Adjust scroll offset
-    if (selectedExample < scrollOffset) scrollOffset = selectedExample;
-    if (selectedExample >= scrollOffset + maxVisibleItems) scrollOffset = selectedExample - maxVisibleItems + 1;
+    char line[512];
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
 
-    // Draw example list
-    int displayIndex = 0;
-    for (int i = 0; i < exampleCount; i++) {
-        // Skip if not in active category
-        if (activeTab != 0 && GetTabIndexFromCategory(examples[i].category) != activeTab) {
+        if (line[0] == '#') {
+            if (strncmp(line, "# baseline ", 11) == 0) {
+                // Revisions longer than the buffer are shown cut
+                if (snprintf(regressionBaseline, sizeof(regressionBaseline), "%s", line + 11) >= (int)sizeof(regressionBaseline)) {
+                    memcpy(regressionBaseline + sizeof(regressionBaseline) - 4, "...", 4);
+                }
+            }
             continue;
         }
 
-        // Skip if outside visible range
-        if (displayIndex < scrollOffset || displayIndex >= scrollOffset + maxVisibleItems) {
-            displayIndex++;
-            continue;
+        char* tab = strchr(line, '\t');
+        if (!tab) continue;
+        *tab = '\0';
+
+        for (int i = 0; i < exampleCount; i++) {
+            if (strcmp(examples[i].name, line) == 0) {
+                examples[i].regressed = true;
+                snprintf(examples[i].regressionText, sizeof(examples[i].regressionText), "%s", tab + 1);
+                if (regressionCount < exampleCount) regressionExamples[regressionCount++] = i;
+                break;
+            }
         }
+    }
+    fclose(fp);
 
-        int yPos = listY + (displayIndex - scrollOffset) * itemHeight;
+    regressionView = (regressionCount > 0);
+}
 
-        // Check mouse hover
-        Vector2 mousePos = GetMousePosition();
-        bool isHovered = CheckCollisionPointRec(mousePos,
-            (Rectangle){10, yPos, screenWidth - 30, itemHeight - 2});
+// Start a private Xvfb server and point DISPLAY to it, returns its pid or -1
+pid_t StartXvfb() {
+    int display = 90 + (int)(getpid()%100);
+    char displayName[16], socketPath[64];
+    snprintf(displayName, sizeof(displayName), ":%d", display);
+    snprintf(socketPath, sizeof(socketPath), "/tmp/.X11-unix/X%d", display);
 
-        // Background
-        Color bgColor;
-        if (i == GetRealIndexFromFiltered(selectedExample)) {
-            bgColor = Fade(GetCategoryColor(examples[i].category), 0.5f);
-        } else if (isHovered) {
-            bgColor = Fade(LIGHTGRAY, 0.8f);
-        } else {
-            bgColor = RAYWHITE;
+    pid_t pid = fork();
+    if (pid == 0) {
+        int nullFd = open("/dev/null", O_WRONLY);
+        if (nullFd >= 0) { dup2(nullFd, STDOUT_FILENO); dup2(nullFd, STDERR_FILENO); }
+        execlp("Xvfb", "Xvfb", displayName, "-screen", "0", "1280x1024x24", "-nolisten", "tcp", (char*)NULL);
+        _exit(127);
+    }
+    if (pid < 0) return -1;
+
+    // Wait for the server socket
+    for (int i = 0; i < 100; i++) {
+        if (access(socketPath, F_OK) == 0) {
+            setenv("DISPLAY", displayName, 1);
+            return pid;
         }
-        DrawRectangle(10, yPos, screenWidth - 30, itemHeight - 2, bgColor);
+        if (waitpid(pid, NULL, WNOHANG) == pid) return -1;
+        usleep(50000);
+    }
 
-        // Border on hover
-        if (isHovered) {
-            DrawRectangleLinesEx((Rectangle){10, yPos, screenWidth - 30, itemHeight - 2}, 2, GRAY);
+    kill(pid, SIGTERM);
+    waitpid(pid, NULL, 0);
+    return -1;
+}
+
+// Build and run every example for a fixed number of frames, then write the frame-time statistics
+int RunFrameBenchmark(const BenchOptions* options) {
+    LoadExamplesList();
+    ResolveCompileFlags();
+    if (exampleCount == 0) return 1;
+
+    char hooksPath[PATH_MAX];
+    if (!realpath(HOOKS_HEADER, hooksPath)) {
+        printf("Could not find " HOOKS_HEADER "\n");
+        return 1;
+    }
+    char benchFlags[PATH_MAX + 16];
+    snprintf(benchFlags, sizeof(benchFlags), "-include %s", hooksPath);
+
+    // Examples run from their own folder, relative paths must be made absolute
+    char inputPath[PATH_MAX] = { 0 };
+    if (options->inputPath && !realpath(options->inputPath, inputPath)) {
+        printf("Could not find input file %s\n", options->inputPath);
+        return 1;
+    }
+    setenv("LAUNCHER_BENCH_INPUT", inputPath, 1);
+
+    setenv("vblank_mode", "0", 1);      // Mesa: never wait for vertical sync
+    if (options->softwareGL) {
+        setenv("LIBGL_ALWAYS_SOFTWARE", "1", 1);
+        setenv("GALLIUM_DRIVER", "llvmpipe", 1);
+    }
+
+    pid_t xvfbPid = -1;
+    if (options->xvfb) {
+        xvfbPid = StartXvfb();
+        if (xvfbPid < 0) {
+            printf("Could not start Xvfb\n");
+            return 1;
         }
+    }
 
-        // Category indicator circle
-        Color catColor = GetCategoryColor(examples[i].category);
-        DrawCircle(30, yPos + itemHeight/2, 8, catColor);
+    BenchResult* results = (BenchResult*)calloc(exampleCount, sizeof(BenchResult));
+    int resultCount = 0;
 
-        // Difficulty stars
-        DrawText(examples[i].difficulty, 50, yPos + 10, 16, GOLD);
+    printf("%-40s %8s %8s %8s %8s %10s %10s  %s\n", "example", "p50 ms", "p95 ms", "p99 ms", "max ms", "startup", "rss KB", "status");
 
-        // Example name
-        Color textColor = (i == GetRealIndexFromFiltered(selectedExample)) ? BLACK : DARKGRAY;
-        DrawText(examples[i].name, 130, yPos + 10, 20, textColor);
+    for (int i = 0; i < exampleCount; i++) {
+        if (options->filter && !strstr(examples[i].name, options->filter)) continue;
 
-        displayIndex++;
+        BenchResult* result = &results[resultCount++];
+        result->exampleIndex = i;
+
+        char binaryPath[512], logPath[512];
+        snprintf(logPath, sizeof(logPath), CACHE_DIR "/%s.log", examples[i].name);
+        if (!GetCachedBinaryPath(i, benchFlags, binaryPath, sizeof(binaryPath)) && !BuildExample(i, benchFlags, binaryPath, logPath)) {
+            snprintf(result->status, sizeof(result->status), "build failed");
+        } else {
+            RunBenchmarkProcess(i, binaryPath, options, result);
+        }
+
+        printf("%-40s %8.3f %8.3f %8.3f %8.3f %8.1fms %10ld  %s\n", examples[i].name,
+               result->p50, result->p95, result->p99, result->max, result->startupTime, result->peakRss, result->status);
+        fflush(stdout);
     }
 
-    // Scrollbar
-    if (filteredCount > maxVisibleItems) {
-        float scrollbarHeight = ((float)maxVisibleItems / filteredCount) * visibleHeight;
-        float scrollbarY = listY + ((float)scrollOffset / filteredCount) * visibleHeight;
-        DrawRectangle(screenWidth - 18, scrollbarY, 14, scrollbarHeight, GRAY);
-        DrawRectangleLines(screenWidth - 18, listY, 14, visibleHeight, LIGHTGRAY);
+    if (xvfbPid > 0) {
+        kill(xvfbPid, SIGTERM);
+        waitpid(xvfbPid, NULL, 0);
     }
-}
 
-// Compile and run an example
-void CompileAndRunExample(int index) {
-    if (index < 0 || index >= exampleCount) return;
+    bool written = WriteBenchResults(options->outputPath, results, resultCount, options);
+    printf("%s %d results to %s\n", written ? "Wrote" : "Could not write", resultCount, options->outputPath);
 
-    char command[1024];
+    // Store the run in the history and compare it with the baseline
+    char rev[64], runPath[512];
+    GetGitRevision(rev, sizeof(rev));
+    uint64_t config = GetBenchConfigKey(options);
+    snprintf(runPath, sizeof(runPath), BENCH_HISTORY_DIR "/%s-%016llx-%lld.run", rev, (unsigned long long)config, (long long)time(NULL));
 
-    // Create a compilation command with pkg-config for proper raylib paths
-    snprintf(command, sizeof(command),
-             "cd raylib-examples/%s && gcc %s.c -o /tmp/%s $(pkg-config --cflags --libs raylib) -framework OpenGL -framework Cocoa -framework IOKit && /tmp/%s",
-             examples[index].category,
-             examples[index].name,
-             examples[index].name,
-             examples[index].name);
-
-    printf("\n==============================================\n");
-    printf("Compiling: %s\n", examples[index].name);
-    printf("Category: %s\n", examples[index].category);
-    printf("Difficulty: %s\n", examples[index].difficulty);
-    printf("==============================================\n");
-
-    // Execute the command
-    int result = system(command);
-    if (result != 0) {
-        printf("\n❌ Compilation/execution failed!\n");
-        printf("Make sure raylib is installed: brew install raylib\n");
-    } else {
-        printf("\n✅ Example completed successfully!\n");
+    if (SaveBenchRun(runPath, rev, config, results, resultCount)) {
+        BenchRun baselines[BENCH_MAX_BASELINE_RUNS];
+        int baselineCount = LoadBaselineRuns(config, options->baselineRev, runPath, baselines, BENCH_MAX_BASELINE_RUNS);
+        CompareWithBaseline(results, resultCount, baselines, baselineCount, rev, options);
+        for (int i = 0; i < baselineCount; i++) UnloadBenchRun(&baselines[i]);
+        printf("Run stored as %s\n", runPath);
     }
-    printf("==============================================\n\n");
+
+    for (int i = 0; i < resultCount; i++) free(results[i].frameTimes);
+    free(results);
+    ClearExamples();
+
+    return written ? 0 : 1;
 }
 
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
-int main(void)
+int main(int argc, char** argv)
 {
+    // Command line modes without a window
+    BenchOptions benchOptions = { BENCH_DEFAULT_FRAMES, BENCH_DEFAULT_TIMEOUT, "bench_results.csv", NULL, NULL, false, false, NULL, BENCH_DEFAULT_THRESHOLD };
+    bool benchmark = false;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = (i + 1 < argc) && (argv[i + 1][0] != '-');
+
+        if (strcmp(argv[i], "--bench-index") == 0) {
+            RunIndexBenchmark(hasValue ? atoi(argv[i + 1]) : 100000);
+            return 0;
+        }
+        else if (strcmp(argv[i], "--bench") == 0) {
+            benchmark = true;
+            if (hasValue) benchOptions.frames = atoi(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--bench-out") == 0 && hasValue) benchOptions.outputPath = argv[++i];
+        else if (strcmp(argv[i], "--bench-input") == 0 && hasValue) benchOptions.inputPath = argv[++i];
+        else if (strcmp(argv[i], "--bench-filter") == 0 && hasValue) benchOptions.filter = argv[++i];
+        else if (strcmp(argv[i], "--bench-timeout") == 0 && hasValue) benchOptions.timeout = atof(argv[++i]);
+        else if (strcmp(argv[i], "--software-gl") == 0) benchOptions.softwareGL = true;
+        else if (strcmp(argv[i], "--xvfb") == 0) benchOptions.xvfb = true;
+        else if (strcmp(argv[i], "--bench-baseline") == 0 && hasValue) benchOptions.baselineRev = argv[++i];
+        else if (strcmp(argv[i], "--bench-threshold") == 0 && hasValue) benchOptions.threshold = atof(argv[++i])/100.0;
+    }
+
+    if (benchmark) return RunFrameBenchmark(&benchOptions);
+
     // Initialization
     const int screenWidth = 1200;
     const int screenHeight = 800;
 
     InitWindow(screenWidth, screenHeight, "Raylib Examples Launcher - Enhanced Edition");
+    SetExitKey(KEY_NULL);   // ESC is handled by the launcher, it also closes the search
     SetTargetFPS(60);
 
     // Load all examples
     LoadExamplesList();
+    ResolveCompileFlags();
+    InitSearchIndex();
+    LoadRegressionReport();
+    if (regressionCount > 0) LogMessage(RED, TextFormat("%d benchmark regressions (%s), R to toggle the view", regressionCount, regressionBaseline));
+
+    bool precompile = false;
+    bool warmLaunch = true;
+    const char* viewPath = NULL;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--precompile") == 0) precompile = true;
+        if (strcmp(argv[i], "--continuous") == 0) idleRendering = false;
+        if (strcmp(argv[i], "--cold") == 0) warmLaunch = false;
+        if (strcmp(argv[i], "--view") == 0 && i + 1 < argc) viewPath = argv[++i];
+    }
 
     if (exampleCount == 0) {
         printf("No examples found! Make sure examples_list.txt exists.\n");
@@ -338,6 +3836,10 @@ int main(void)
         return 1;
     }
 
+    InitWarmLaunching(warmLaunch);
+    if (precompile) StartBuildPool();
+    if (viewPath && !OpenSourceViewer(viewPath)) LogMessage(RED, TextFormat("Could not open %s: %s", viewPath, strerror(errno)));
+
     // Main loop
     while (!WindowShouldClose())
     {
@@ -347,54 +3849,85 @@ int main(void)
         int filteredCount = GetFilteredExampleCount();
         int realSelectedIndex = GetRealIndexFromFiltered(selectedExample);
 
-        // Mouse wheel scrolling
-        float wheelMove = GetMouseWheelMove();
-        if (wheelMove != 0) {
-            selectedExample -= (int)wheelMove * 3;
-            if (selectedExample < 0) selectedExample = 0;
-            if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
-        }
-
-        // Tab clicking
-        Vector2 mousePos = GetMousePosition();
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            int tabWidth = screenWidth / TAB_COUNT;
-            if (mousePos.y < 50) {
-                int clickedTab = (int)(mousePos.x / tabWidth);
-                if (clickedTab >= 0 && clickedTab < TAB_COUNT) {
-                    activeTab = clickedTab;
-                    selectedExample = 0;
-                    scrollOffset = 0;
-                }
-            }
+        // Advance compilation/run in progress
+        UpdateLaunch();
+        UpdateResourceMonitor();
+        RefillWarmPool();
+        UpdateBuildPool();
+
+        // Escape closes the search first, then the launcher
+        if (IsKeyPressed(KEY_ESCAPE)) {
+            if (viewerActive) CloseSourceViewer();
+            else if (searchActive) searchActive = false;
+            else break;
         }
 
-        // Mouse clicking on examples
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
-            int tabHeight = 50;
-            int listY = tabHeight + 10;
-            int itemHeight = 40;
+        if (viewerActive) {
+            UpdateSourceViewer();
+            if (IsKeyPressed(KEY_C)) CloseSourceViewer();
+        } else if (searchActive) {
+            // Search-as-you-type, keys go to the query
+            UpdateSearch();
+
+            float searchWheel = GetMouseWheelMove();
+            if (searchWheel != 0) {
+                searchSelected -= (int)searchWheel;
+                if (searchSelected >= searchResultCount) searchSelected = searchResultCount - 1;
+                if (searchSelected < 0) searchSelected = 0;
+            }
+
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                int row = (GetMouseY() - 96)/58;
+                if (GetMouseY() >= 96 && row >= 0 && searchScroll + row < searchResultCount) searchSelected = searchScroll + row;
+            }
 
-            int displayIndex = 0;
-            for (int i = 0; i < exampleCount; i++) {
-                if (activeTab != 0 && GetTabIndexFromCategory(examples[i].category) != activeTab) {
-                    continue;
+            // Run the example of the selected result, it also becomes the selection of the list
+            if (IsKeyPressed(KEY_ENTER) && searchSelected < searchResultCount) {
+                int exampleIndex = searchFiles[searchResults[searchSelected].fileIndex].exampleIndex;
+                if (exampleIndex >= 0) {
+                    activeTab = 0;
+                    selectedExample = exampleIndex;
+                    CompileAndRunExample(exampleIndex);
                 }
+            }
+        } else {
+            // Mouse wheel scrolling, over the log panel it scrolls the output
+            float wheelMove = GetMouseWheelMove();
+            bool overLogPanel = logPanelVisible && (GetMouseY() >= screenHeight - 110 - LOG_PANEL_HEIGHT) && (GetMouseY() < screenHeight - 110);
+            if (wheelMove != 0 && overLogPanel) {
+                logScroll += (int)wheelMove*3;
+            } else if (wheelMove != 0) {
+                selectedExample -= (int)wheelMove * (gridView ? gridColumns : 3);
+                if (selectedExample < 0) selectedExample = 0;
+                if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
+            }
 
-                if (displayIndex < scrollOffset || displayIndex >= scrollOffset + maxVisibleItems) {
-                    displayIndex++;
-                    continue;
+            // Tab clicking
+            Vector2 mousePos = GetMousePosition();
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                int tabWidth = screenWidth / TAB_COUNT;
+                if (mousePos.y < 50) {
+                    int clickedTab = (int)(mousePos.x / tabWidth);
+                    if (clickedTab >= 0 && clickedTab < TAB_COUNT) {
+                        activeTab = clickedTab;
+                        regressionView = false;
+                        selectedExample = 0;
+                        scrollOffset = 0;
+                    }
                 }
+            }
 
-                int yPos = listY + (displayIndex - scrollOffset) * itemHeight;
+            // Mouse clicking on examples
+            if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) {
+                int displayIndex = GetFilteredIndexAtPosition(mousePos, screenWidth);
 
-                if (CheckCollisionPointRec(mousePos, (Rectangle){10, yPos, screenWidth - 30, itemHeight - 2})) {
+                if (displayIndex != -1) {
                     double currentTime = GetTime();
 
                     // Double-click detection
                     if (lastClickedIndex == displayIndex && (currentTime - lastClickTime) < 0.3) {
                         // Double-click: run example
-                        CompileAndRunExample(i);
+                        CompileAndRunExample(GetRealIndexFromFiltered(displayIndex));
                         lastClickedIndex = -1;
                     } else {
                         // Single click: select
@@ -402,59 +3935,105 @@ int main(void)
                         lastClickedIndex = displayIndex;
                         lastClickTime = currentTime;
                     }
-                    break;
                 }
+            }
 
-                displayIndex++;
+            // Keyboard navigation, a whole row at a time in the grid
+            int rowStep = gridView ? gridColumns : 1;
+            if (IsKeyPressed(KEY_UP) && selectedExample - rowStep >= 0) selectedExample -= rowStep;
+            if (IsKeyPressed(KEY_DOWN)) {
+                selectedExample += rowStep;
+                if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
             }
-        }
+            if (gridView && IsKeyPressed(KEY_LEFT) && selectedExample > 0) selectedExample--;
+            if (gridView && IsKeyPressed(KEY_RIGHT) && selectedExample < filteredCount - 1) selectedExample++;
 
-        // Keyboard navigation
-        if (IsKeyPressed(KEY_UP)) {
-            selectedExample--;
-            if (selectedExample < 0) selectedExample = 0;
-        }
-        if (IsKeyPressed(KEY_DOWN)) {
-            selectedExample++;
-            if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
-        }
+            // Page navigation
+            if (IsKeyPressed(KEY_PAGE_UP)) {
+                selectedExample -= maxVisibleItems;
+                if (selectedExample < 0) selectedExample = 0;
+            }
+            if (IsKeyPressed(KEY_PAGE_DOWN)) {
+                selectedExample += maxVisibleItems;
+                if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
+            }
 
-        // Page navigation
-        if (IsKeyPressed(KEY_PAGE_UP)) {
-            selectedExample -= maxVisibleItems;
-            if (selectedExample < 0) selectedExample = 0;
-        }
-        if (IsKeyPressed(KEY_PAGE_DOWN)) {
-            selectedExample += maxVisibleItems;
-            if (selectedExample >= filteredCount) selectedExample = filteredCount - 1;
-        }
+            // Home/End
+            if (IsKeyPressed(KEY_HOME)) selectedExample = 0;
+            if (IsKeyPressed(KEY_END)) selectedExample = filteredCount - 1;
 
-        // Home/End
-        if (IsKeyPressed(KEY_HOME)) selectedExample = 0;
-        if (IsKeyPressed(KEY_END)) selectedExample = filteredCount - 1;
+            // Run selected example
+            if (IsKeyPressed(KEY_ENTER)) {
+                CompileAndRunExample(realSelectedIndex);
+            }
 
-        // Run selected example
-        if (IsKeyPressed(KEY_ENTER)) {
-            CompileAndRunExample(realSelectedIndex);
-        }
+            // View source code
+            if (IsKeyPressed(KEY_C)) viewerParentPath[0] = '\0';
+            if (IsKeyPressed(KEY_C) && !OpenSourceViewer(examples[realSelectedIndex].filepath)) {
+                LogMessage(RED, TextFormat("Could not open %s: %s", examples[realSelectedIndex].filepath, strerror(errno)));
+            }
+
+            // Toggle log panel
+            if (IsKeyPressed(KEY_L)) logPanelVisible = !logPanelVisible;
+
+            // Toggle the thumbnail grid, screenshots are only loaded once it is shown
+            if (IsKeyPressed(KEY_G)) {
+                gridView = !gridView;
+                if (gridView) StartThumbnailLoader();
+            }
+
+            // Toggle the benchmark regressions view
+            if (IsKeyPressed(KEY_R) && regressionCount > 0) {
+                regressionView = !regressionView;
+                selectedExample = 0;
+                scrollOffset = 0;
+            }
+
+            // Toggle background precompilation
+            if (IsKeyPressed(KEY_B)) {
+                if (IsBuildPoolStopping()) LogMessage(ORANGE, "Precompilation is stopping, waiting for the builds in progress");
+                else if (buildPoolRunning) StopBuildPool();
+                else StartBuildPool();
+            }
+
+            // Quick tab switching with number keys
+            if (IsKeyPressed(KEY_ONE) || IsKeyPressed(KEY_TWO) || IsKeyPressed(KEY_THREE) || IsKeyPressed(KEY_FOUR) ||
+                IsKeyPressed(KEY_FIVE) || IsKeyPressed(KEY_SIX) || IsKeyPressed(KEY_SEVEN) || IsKeyPressed(KEY_EIGHT)) regressionView = false;
+            if (IsKeyPressed(KEY_ONE)) { activeTab = 0; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_TWO)) { activeTab = 1; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_THREE)) { activeTab = 2; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_FOUR)) { activeTab = 3; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_FIVE)) { activeTab = 4; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_SIX)) { activeTab = 5; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_SEVEN)) { activeTab = 6; selectedExample = 0; scrollOffset = 0; }
+            if (IsKeyPressed(KEY_EIGHT)) { activeTab = 7; selectedExample = 0; scrollOffset = 0; }
 
-        // View source code
-        if (IsKeyPressed(KEY_C)) {
-            char command[512];
-            snprintf(command, sizeof(command), "cat %s", examples[realSelectedIndex].filepath);
-            system(command);
+            // Open source search
+            if (IsKeyPressed(KEY_SLASH) || ((IsKeyDown(KEY_LEFT_CONTROL) || IsKeyDown(KEY_RIGHT_CONTROL)) && IsKeyPressed(KEY_F))) {
+                searchActive = true;
+                RunSearch();
+            }
         }
 
-        // Quick tab switching with number keys
-        if (IsKeyPressed(KEY_ONE)) { activeTab = 0; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_TWO)) { activeTab = 1; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_THREE)) { activeTab = 2; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_FOUR)) { activeTab = 3; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_FIVE)) { activeTab = 4; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_SIX)) { activeTab = 5; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_SEVEN)) { activeTab = 6; selectedExample = 0; scrollOffset = 0; }
-        if (IsKeyPressed(KEY_EIGHT)) { activeTab = 7; selectedExample = 0; scrollOffset = 0; }
+        // Builds near the cursor go first
+        if (buildPoolRunning) SetBuildFocus(activeTab, GetRealIndexFromFiltered(selectedExample));
+
+        // Idle rendering: without input or background changes the frame would be the same,
+        // sleep until a background job asks for a redraw or it is time to poll the input again
+        if (IsKeyPressed(KEY_I) && !viewerActive && !searchActive) idleRendering = !idleRendering;
 
+        pthread_mutex_lock(&redrawMutex);
+        unsigned int pendingRedraws = redrawRequests;
+        pthread_mutex_unlock(&redrawMutex);
+
+        if (idleRendering && (pendingRedraws == redrawHandled) && !HasInputActivity() && (GetTime() - lastRedrawTime < IDLE_REFRESH_INTERVAL)) {
+            WaitForRedraw(IDLE_POLL_INTERVAL);
+            PollInputEvents();
+            continue;
+        }
+        redrawHandled = pendingRedraws;
+        lastRedrawTime = GetTime();
+        UpdateCpuUsage();
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -465,21 +4044,44 @@ int main(void)
             // Draw tabs
             DrawTabs(screenWidth);
 
-            // Draw example list
-            DrawExampleList(screenWidth, screenHeight);
+            // Draw example list, or the search results while searching
+            if (viewerActive) DrawSourceViewer(screenWidth, screenHeight);
+            else if (searchActive) DrawSearchPanel(screenWidth, screenHeight);
+            else if (gridView) DrawExampleGrid(screenWidth, screenHeight);
+            else DrawExampleList(screenWidth, screenHeight);
 
             // Footer with selected example info
             int footerY = screenHeight - 110;
+            if (logPanelVisible) DrawLogPanel(0, footerY - LOG_PANEL_HEIGHT, screenWidth, LOG_PANEL_HEIGHT);
             DrawRectangle(0, footerY, screenWidth, 110, DARKGRAY);
 
             if (realSelectedIndex >= 0 && realSelectedIndex < exampleCount) {
                 // Title
                 DrawText("SELECTED EXAMPLE:", 20, footerY + 10, 18, LIGHTGRAY);
+                DrawText(TextFormat("Rendering: %s  |  CPU %.1f%%  |  %.0f fps", idleRendering ? "idle (I)" : "continuous (I)", cpuUsage, drawnFps),
+                    240, footerY + 13, 14, GRAY);
 
                 // Example name with category color
-                Color catColor = GetCategoryColor(examples[realSelectedIndex].category);
+                Color catColor = GetCategoryColor(examples[realSelectedIndex].categoryId);
                 DrawRectangle(20, footerY + 35, 10, 35, catColor);
                 DrawText(examples[realSelectedIndex].name, 40, footerY + 38, 24, WHITE);
+                int tagX = 50 + MeasureText(examples[realSelectedIndex].name, 24);
+                if (examples[realSelectedIndex].lastLaunchCached) {
+                    DrawText("[cached]", tagX, footerY + 44, 16, LIME);
+                    tagX += MeasureText("[cached]", 16) + 10;
+                }
+
+                // Time to first frame of the last run
+                if (examples[realSelectedIndex].firstFrameTime > 0) {
+                    DrawText(TextFormat("[first frame %.0f ms%s]", examples[realSelectedIndex].firstFrameTime,
+                        examples[realSelectedIndex].lastLaunchWarm ? ", warm" : ""),
+                        tagX, footerY + 44, 16, examples[realSelectedIndex].lastLaunchWarm ? LIME : LIGHTGRAY);
+                }
+
+                // Benchmark regression against the baseline
+                if (examples[realSelectedIndex].regressed) {
+                    DrawText(examples[realSelectedIndex].regressionText, 20, footerY + 90, 14, RED);
+                }
 
                 // Info line
                 DrawText(TextFormat("Category: %s  |  Difficulty: %s  |  File: %s",
@@ -487,10 +4089,38 @@ int main(void)
                     examples[realSelectedIndex].difficulty,
                     examples[realSelectedIndex].filepath),
                     20, footerY + 70, 16, LIGHTGRAY);
+
+                // Live resources of the running example, or the last launch results with their resources summary
+                if (launchStage == LAUNCH_RUNNING) {
+                    DrawResourceMonitor(screenWidth - 520, footerY + 48);
+                } else if (examples[realSelectedIndex].exitStatus != -1) {
+                    bool hasResources = examples[realSelectedIndex].resources.valid;
+                    DrawText(TextFormat("Last run: %s  |  compile %.0f ms  |  run %.2f s",
+                        GetExitStatusText(examples[realSelectedIndex].exitStatus),
+                        examples[realSelectedIndex].compileTime, examples[realSelectedIndex].runTime),
+                        screenWidth - 520, footerY + (hasResources ? 44 : 50), hasResources ? 12 : 14, LIGHTGRAY);
+                    if (hasResources) DrawText(GetResourceSummaryText(&examples[realSelectedIndex].resources), screenWidth - 520, footerY + 57, 12, LIGHTGRAY);
+                }
+
+            }
+
+            // Compile cache stats
+            int cacheLaunches = cacheHits + cacheMisses;
+            DrawText(TextFormat("Cache: %d hits / %d misses (%.0f%% hit rate)  |  Last launch: %.1f ms",
+                cacheHits, cacheMisses, (cacheLaunches > 0) ? 100.0f*cacheHits/cacheLaunches : 0.0f, lastLaunchTime),
+                screenWidth - 520, footerY + 10, 14, LIGHTGRAY);
+
+            // Precompilation progress
+            if (buildPoolRunning) {
+                int ready = 0, failed = 0, pending = 0;
+                GetBuildProgress(&ready, &failed, &pending);
+                DrawText(TextFormat("Precompile: %d/%d ready, %d failed, %d pending (%d workers%s)",
+                    ready, exampleCount, failed, pending, buildWorkerCount, IsBuildPoolStopping() ? ", stopping" : ""),
+                    screenWidth - 520, footerY + 30, 14, (pending > 0) ? ORANGE : LIME);
             }
 
-            // Instructions
-            DrawText("🖱️ CLICK to select  |  DOUBLE-CLICK to run  |  SCROLL to navigate  |  ENTER to compile & run  |  ESC to exit",
+            // Instructions, the regression diff takes their place
+            if (realSelectedIndex < 0 || realSelectedIndex >= exampleCount || !examples[realSelectedIndex].regressed) DrawText("🖱️ CLICK to select  |  DOUBLE-CLICK to run  |  SCROLL to navigate  |  ENTER to compile & run  |  G for grid  |  / to search  |  ESC to exit",
                 20, footerY + 90, 14, GRAY);
 
         EndDrawing();
@@ -498,7 +4128,15 @@ int main(void)
     }
 
     // De-Initialization
+    StopLaunch();
+    StopWarmPool();
+    StopBuildPool();
+    JoinBuildPool();
+    StopThumbnailLoader();
+    CloseSourceViewer();
     CloseWindow();
+    UnloadSearchIndex();
+    ClearExamples();
 
     return 0;
 }
@@ -0,0 +1,111 @@
+/*******************************************************************************************
+*
+*   launcher_helper - Warm host process for examples run by the examples launcher
+*
+*   The launcher starts a few helpers ahead of time. Each helper has raylib and the system
+*   libraries already linked and their pages prefetched, and waits with a hidden window
+*   already created, so an example handed to it skips most of the startup work.
+*
+*   Examples are built as shared objects with their main() renamed:
+*
+*       gcc example.c -include launcher_hooks.h -shared -fPIC -Dmain=LauncherExampleMain ...
+*
+*   The helper reads one request from stdin, runs the example and exits with its result:
+*       <example shared object path>\n
+*       <working directory>\n
+*
+*   launcher_hooks.h reuses the hidden window in InitWindow() when raylib is shared between
+*   the helper and the example, and reports the first frame on LAUNCHER_FIRST_FRAME_FD.
+*
+**********************************************************************************************/
+
+#if defined(__linux__)
+    #define _GNU_SOURCE     // Required for: dl_iterate_phdr()
+#endif
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: fgets(), fprintf()
+#include <string.h>         // Required for: strcspn()
+#include <stdlib.h>         // Required for: exit()
+#include <stdint.h>         // Required for: uintptr_t
+#include <unistd.h>         // Required for: chdir(), sysconf()
+#include <dlfcn.h>          // Required for: dlopen(), dlsym()
+
+#if defined(__linux__)
+    #include <link.h>       // Required for: dl_iterate_phdr()
+    #include <sys/mman.h>   // Required for: madvise()
+#endif
+
+#define HELPER_WINDOW_WIDTH 800
+#define HELPER_WINDOW_HEIGHT 450
+
+typedef int (*ExampleMain)(int argc, char **argv);
+
+#if defined(__linux__)
+// Prefetch the loaded segments of every linked library and touch their pages,
+// so the example does not pay the page faults of raylib, libGL and the driver
+static int PrefetchObject(struct dl_phdr_info *info, size_t size, void *data)
+{
+    (void)size;
+    (void)data;
+    long pageSize = sysconf(_SC_PAGESIZE);
+
+    for (int i = 0; i < info->dlpi_phnum; i++)
+    {
+        const ElfW(Phdr) *segment = &info->dlpi_phdr[i];
+        if ((segment->p_type != PT_LOAD) || !(segment->p_flags & PF_R)) continue;
+
+        uintptr_t start = (uintptr_t)(info->dlpi_addr + segment->p_vaddr) & ~(uintptr_t)(pageSize - 1);
+        uintptr_t end = (uintptr_t)(info->dlpi_addr + segment->p_vaddr + segment->p_memsz);
+
+        madvise((void *)start, end - start, MADV_WILLNEED);
+
+        volatile unsigned char sum = 0;
+        for (uintptr_t page = start; page < end; page += pageSize) sum += *(volatile unsigned char *)page;
+    }
+
+    return 0;
+}
+#endif
+
+int main(void)
+{
+    // Create the window ahead of time, quietly: the launcher only shows the example output
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(HELPER_WINDOW_WIDTH, HELPER_WINDOW_HEIGHT, "raylib");
+    SetTraceLogLevel(LOG_INFO);
+
+#if defined(__linux__)
+    dl_iterate_phdr(PrefetchObject, NULL);
+#endif
+
+    // Wait for the example to run
+    char path[1024] = { 0 };
+    char workDir[1024] = { 0 };
+    if (!fgets(path, sizeof(path), stdin) || !fgets(workDir, sizeof(workDir), stdin)) return 0;
+    path[strcspn(path, "\r\n")] = '\0';
+    workDir[strcspn(workDir, "\r\n")] = '\0';
+
+    // Relative resources paths of the example resolve from its folder
+    if (chdir(workDir) != 0)
+    {
+        fprintf(stderr, "launcher_helper: could not enter %s\n", workDir);
+        return 127;
+    }
+
+    void *example = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+    ExampleMain exampleMain = (example != NULL) ? (ExampleMain)dlsym(example, "LauncherExampleMain") : NULL;
+    if (exampleMain == NULL)
+    {
+        fprintf(stderr, "launcher_helper: %s\n", dlerror());
+        return 127;
+    }
+
+    // An example with its own copy of raylib (static library) creates its own window
+    if ((void *)dlsym(example, "InitWindow") != (void *)InitWindow) CloseWindow();
+
+    char *argv[] = { path, NULL };
+    exit(exampleMain(1, argv));
+}
@@ -0,0 +1,288 @@
+/*******************************************************************************************
+*
+*   launcher_hooks - Frame hooks for examples run by the examples launcher
+*
+*   Wraps a few raylib calls of an example with macros, so the launcher can measure it
+*   without any change to the example code. The launcher force-includes this header:
+*
+*       gcc example.c -include launcher_hooks.h ...
+*
+*   Hooks do nothing unless the launcher sets these environment variables:
+*       LAUNCHER_BENCH_FRAMES   Run for this number of frames, then make WindowShouldClose() return true
+*       LAUNCHER_BENCH_OUTPUT   Write the timestamp of the first frame and every frame time to this file
+*       LAUNCHER_BENCH_INPUT    Replay this automation events file (.rae), recorded with core_automation_events
+*       LAUNCHER_FIRST_FRAME_FD Write the timestamp of the first frame to this file descriptor
+*       LAUNCHER_MONITOR_FD     Shared memory (LauncherMonitorRing) receiving the timings of every frame
+*
+*   While benchmarking, SetTargetFPS() is ignored so frames are not paced and the random seed is
+*   fixed, so every run of an example gets the same input and the same random values.
+*
+*   Run by launcher_helper, the window may already exist (hidden): InitWindow() then reuses it,
+*   unless the example asked for flags that only apply when the window is created, and GetTime()
+*   counts from the InitWindow() call of the example.
+*
+*   The launcher includes this header with LAUNCHER_HOOKS_TYPES_ONLY defined, to share the layout
+*   of the frame timings ring buffer without the hooks.
+*
+**********************************************************************************************/
+
+#ifndef LAUNCHER_HOOKS_H
+#define LAUNCHER_HOOKS_H
+
+#include "raylib.h"
+
+#include <stdio.h>          // Required for: FILE, fopen(), fprintf(), fclose()
+#include <stdlib.h>         // Required for: getenv(), atoi(), malloc(), free()
+#include <time.h>           // Required for: clock_gettime()
+#include <unistd.h>         // Required for: write(), close()
+#include <stdatomic.h>      // Required for: atomic_load_explicit(), atomic_store_explicit()
+#include <sys/mman.h>       // Required for: mmap()
+#include <sys/stat.h>       // Required for: fstat()
+
+#define LAUNCHER_MONITOR_MAGIC 0x4d4f4e31
+#define LAUNCHER_MONITOR_CAPACITY 1024      // Frames kept in the ring, power of two
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct LauncherMonitorFrame {
+    float frameTime;            // End of the previous frame to the end of this one (ms)
+    float updateTime;           // End of the previous frame to BeginDrawing() (ms)
+    float drawTime;             // BeginDrawing() to EndDrawing(), without buffer swap and frame pacing (ms)
+} LauncherMonitorFrame;
+
+// Single producer (the example), single consumer (the launcher) ring of frame timings
+// NOTE: Frame n is stored at n%LAUNCHER_MONITOR_CAPACITY, written is only increased once the frame is stored
+typedef struct LauncherMonitorRing {
+    unsigned int magic;
+    _Atomic unsigned int written;   // Frames written since the ring was created
+    LauncherMonitorFrame frames[LAUNCHER_MONITOR_CAPACITY];
+} LauncherMonitorRing;
+
+#if !defined(LAUNCHER_HOOKS_TYPES_ONLY)
+
+#define LAUNCHER_HOOKS_SEED 0x5eed
+
+// Flags that only apply when the window is created, a reused window is created again for them
+#define LAUNCHER_HOOKS_CREATION_FLAGS (FLAG_FULLSCREEN_MODE | FLAG_WINDOW_TRANSPARENT | FLAG_MSAA_4X_HINT | FLAG_WINDOW_HIGHDPI | FLAG_INTERLACED_HINT)
+
+typedef struct LauncherHooksState {
+    bool benchmark;             // Benchmark mode, enabled by LAUNCHER_BENCH_FRAMES
+    int frameLimit;             // Frames to run
+    int frameCounter;           // Frames completed
+    double firstFrameTime;      // Monotonic time at the end of the first frame (s)
+    double lastFrameTime;       // Monotonic time at the end of the previous frame (s)
+    float *frameTimes;          // Frame times (ms), frameLimit entries
+    const char *outputPath;
+    bool inputPlaying;
+    AutomationEventList input;  // Recorded input to replay
+    unsigned int inputEvent;    // Next event to play
+    int firstFrameFd;           // First frame report, -1 if not requested
+    unsigned int configFlags;   // Flags set by the example before InitWindow()
+    double timeOffset;          // GetTime() of a reused window when the example called InitWindow()
+    double beginDrawingTime;    // Monotonic time of the last BeginDrawing() (s)
+    LauncherMonitorRing *monitor;   // Frame timings shared with the launcher, NULL if not requested
+} LauncherHooksState;
+
+static LauncherHooksState launcherHooks = { .firstFrameFd = -1 };
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Monotonic clock shared with the launcher process
+static double LauncherHooksGetTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec*1e-9;
+}
+
+// Play the recorded events of the current frame, events are played after input polling
+static void LauncherHooksPlayInput(void)
+{
+    while (launcherHooks.inputPlaying && (launcherHooks.input.events[launcherHooks.inputEvent].frame == (unsigned int)launcherHooks.frameCounter))
+    {
+        PlayAutomationEvent(launcherHooks.input.events[launcherHooks.inputEvent]);
+        launcherHooks.inputEvent++;
+        if (launcherHooks.inputEvent >= launcherHooks.input.count) launcherHooks.inputPlaying = false;
+    }
+}
+
+// Write the first frame timestamp and all frame times
+static void LauncherHooksWriteOutput(void)
+{
+    if (launcherHooks.outputPath == NULL) return;
+
+    FILE *file = fopen(launcherHooks.outputPath, "w");
+    if (file == NULL) return;
+
+    fprintf(file, "first_frame %.9f\n", launcherHooks.firstFrameTime);
+    for (int i = 0; i < launcherHooks.frameCounter; i++) fprintf(file, "%.4f\n", launcherHooks.frameTimes[i]);
+    fclose(file);
+
+    launcherHooks.outputPath = NULL;
+}
+
+// Map the frame timings ring created by the launcher, ignored if it is not one
+static void LauncherHooksOpenMonitor(int fd)
+{
+    struct stat info;
+    if ((fstat(fd, &info) == 0) && (info.st_size >= (off_t)sizeof(LauncherMonitorRing)))
+    {
+        void *ring = mmap(NULL, sizeof(LauncherMonitorRing), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ring != MAP_FAILED)
+        {
+            if (((LauncherMonitorRing *)ring)->magic == LAUNCHER_MONITOR_MAGIC) launcherHooks.monitor = (LauncherMonitorRing *)ring;
+            else munmap(ring, sizeof(LauncherMonitorRing));
+        }
+    }
+
+    close(fd);
+}
+
+// Publish the timings of the frame that just ended
+static void LauncherHooksWriteMonitor(double endTime, double workEndTime)
+{
+    unsigned int index = atomic_load_explicit(&launcherHooks.monitor->written, memory_order_relaxed);
+    LauncherMonitorFrame *frame = &launcherHooks.monitor->frames[index%LAUNCHER_MONITOR_CAPACITY];
+    double beginTime = (launcherHooks.beginDrawingTime > launcherHooks.lastFrameTime) ? launcherHooks.beginDrawingTime : launcherHooks.lastFrameTime;
+
+    frame->frameTime = (float)((endTime - launcherHooks.lastFrameTime)*1000.0);
+    frame->updateTime = (float)((beginTime - launcherHooks.lastFrameTime)*1000.0);
+    frame->drawTime = (float)((workEndTime - beginTime)*1000.0);
+
+    atomic_store_explicit(&launcherHooks.monitor->written, index + 1, memory_order_release);
+}
+
+static void LauncherHooksSetConfigFlags(unsigned int flags)
+{
+    launcherHooks.configFlags |= flags;
+    if (!IsWindowReady()) SetConfigFlags(flags);
+}
+
+// Show the hidden window created by launcher_helper as if it was just created
+static void LauncherHooksReuseWindow(int width, int height, const char *title)
+{
+    int monitor = GetCurrentMonitor();
+
+    SetWindowTitle(title);
+    SetWindowSize(width, height);
+    SetWindowPosition((GetMonitorWidth(monitor) - width)/2, (GetMonitorHeight(monitor) - height)/2);
+    if (launcherHooks.configFlags & ~FLAG_WINDOW_HIDDEN) SetWindowState(launcherHooks.configFlags & ~FLAG_WINDOW_HIDDEN);
+    if (!(launcherHooks.configFlags & FLAG_WINDOW_HIDDEN)) ClearWindowState(FLAG_WINDOW_HIDDEN);
+
+    launcherHooks.timeOffset = GetTime();
+}
+
+static void LauncherHooksInitWindow(int width, int height, const char *title)
+{
+    const char *frames = getenv("LAUNCHER_BENCH_FRAMES");
+    const char *inputPath = getenv("LAUNCHER_BENCH_INPUT");
+    const char *firstFrameFd = getenv("LAUNCHER_FIRST_FRAME_FD");
+    const char *monitorFd = getenv("LAUNCHER_MONITOR_FD");
+
+    if ((firstFrameFd != NULL) && (firstFrameFd[0] != '\0')) launcherHooks.firstFrameFd = atoi(firstFrameFd);
+    if ((monitorFd != NULL) && (monitorFd[0] != '\0')) LauncherHooksOpenMonitor(atoi(monitorFd));
+
+    if ((frames != NULL) && (atoi(frames) > 0))
+    {
+        launcherHooks.benchmark = true;
+        launcherHooks.frameLimit = atoi(frames);
+        launcherHooks.frameTimes = (float *)malloc(launcherHooks.frameLimit*sizeof(float));
+        launcherHooks.outputPath = getenv("LAUNCHER_BENCH_OUTPUT");
+    }
+
+    if (IsWindowReady() && !(launcherHooks.configFlags & LAUNCHER_HOOKS_CREATION_FLAGS)) LauncherHooksReuseWindow(width, height, title);
+    else
+    {
+        if (IsWindowReady())
+        {
+            CloseWindow();
+            SetConfigFlags(launcherHooks.configFlags);
+        }
+        InitWindow(width, height, title);
+    }
+
+    if (launcherHooks.benchmark) SetRandomSeed(LAUNCHER_HOOKS_SEED);
+
+    if ((inputPath != NULL) && (inputPath[0] != '\0'))
+    {
+        launcherHooks.input = LoadAutomationEventList(inputPath);
+        launcherHooks.inputPlaying = (launcherHooks.input.count > 0);
+        LauncherHooksPlayInput();
+    }
+
+    launcherHooks.lastFrameTime = LauncherHooksGetTime();
+}
+
+static double LauncherHooksGetWindowTime(void)
+{
+    return GetTime() - launcherHooks.timeOffset;
+}
+
+static void LauncherHooksSetTargetFPS(int fps)
+{
+    SetTargetFPS(launcherHooks.benchmark ? 0 : fps);
+}
+
+static bool LauncherHooksWindowShouldClose(void)
+{
+    if (launcherHooks.benchmark && (launcherHooks.frameCounter >= launcherHooks.frameLimit))
+    {
+        LauncherHooksWriteOutput();
+        return true;
+    }
+
+    return WindowShouldClose();
+}
+
+static void LauncherHooksBeginDrawing(void)
+{
+    launcherHooks.beginDrawingTime = LauncherHooksGetTime();
+    BeginDrawing();
+}
+
+static void LauncherHooksEndDrawing(void)
+{
+    double workEndTime = LauncherHooksGetTime();
+    EndDrawing();
+
+    double now = LauncherHooksGetTime();
+    if (launcherHooks.monitor != NULL) LauncherHooksWriteMonitor(now, workEndTime);
+
+    if (launcherHooks.frameCounter == 0)
+    {
+        launcherHooks.firstFrameTime = now;
+
+        if (launcherHooks.firstFrameFd >= 0)
+        {
+            char report[32];
+            int length = snprintf(report, sizeof(report), "%.9f\n", now);
+            ssize_t written = write(launcherHooks.firstFrameFd, report, length);
+            (void)written;
+            close(launcherHooks.firstFrameFd);
+            launcherHooks.firstFrameFd = -1;
+        }
+    }
+    if (launcherHooks.benchmark && (launcherHooks.frameCounter < launcherHooks.frameLimit))
+    {
+        launcherHooks.frameTimes[launcherHooks.frameCounter] = (float)((now - launcherHooks.lastFrameTime)*1000.0);
+    }
+    launcherHooks.lastFrameTime = now;
+    launcherHooks.frameCounter++;
+
+    LauncherHooksPlayInput();
+}
+
+// Route the example calls to the hooks, real functions are still reachable from the hooks above
+#define SetConfigFlags(flags) LauncherHooksSetConfigFlags(flags)
+#define InitWindow(width, height, title) LauncherHooksInitWindow(width, height, title)
+#define GetTime() LauncherHooksGetWindowTime()
+#define SetTargetFPS(fps) LauncherHooksSetTargetFPS(fps)
+#define WindowShouldClose() LauncherHooksWindowShouldClose()
+#define BeginDrawing() LauncherHooksBeginDrawing()
+#define EndDrawing() LauncherHooksEndDrawing()
+
+#endif // !LAUNCHER_HOOKS_TYPES_ONLY
+
+#endif // LAUNCHER_HOOKS_H
@@ -19,6 +19,60 @@
 
 #include "reasings.h"       // Required for easing functions
 
+#include <math.h>           // Required for: fminf(), fabsf(), fmaxf()
+
+#if defined(__AVX__)
+    #include <immintrin.h>  // Required for: AVX intrinsics
+    #define TWEEN_SIMD_WIDTH 8
+    #define TWEEN_SIMD_NAME "AVX"
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #define TWEEN_SIMD_WIDTH 4
+    #define TWEEN_SIMD_NAME "SSE2"
+#else
+    #define TWEEN_SIMD_WIDTH 1      // No SIMD instruction set available, the SIMD path runs the scalar easings
+    #define TWEEN_SIMD_NAME "none"
+#endif
+
+// SIMD operations used by the tweens update, TWEEN_SIMD_WIDTH lanes
+#if (TWEEN_SIMD_WIDTH == 8)
+    #define SIMD_FLOAT __m256
+    #define SIMD_SET(value) _mm256_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm256_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm256_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm256_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm256_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm256_mul_ps(a, b)
+    #define SIMD_DIV(a, b) _mm256_div_ps(a, b)
+    #define SIMD_MIN(a, b) _mm256_min_ps(a, b)
+    #define SIMD_MAX(a, b) _mm256_max_ps(a, b)
+    #define SIMD_SQRT(a) _mm256_sqrt_ps(a)
+    #define SIMD_ROUND(a) _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+    #define SIMD_CMPLT(a, b) _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+    #define SIMD_CMPEQ(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+    #define SIMD_CMPGE(a, b) _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+    #define SIMD_SELECT(mask, a, b) _mm256_blendv_ps(b, a, mask)
+    #define SIMD_MOVEMASK(mask) _mm256_movemask_ps(mask)
+#elif (TWEEN_SIMD_WIDTH == 4)
+    #define SIMD_FLOAT __m128
+    #define SIMD_SET(value) _mm_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm_mul_ps(a, b)
+    #define SIMD_DIV(a, b) _mm_div_ps(a, b)
+    #define SIMD_MIN(a, b) _mm_min_ps(a, b)
+    #define SIMD_MAX(a, b) _mm_max_ps(a, b)
+    #define SIMD_SQRT(a) _mm_sqrt_ps(a)
+    #define SIMD_ROUND(a) _mm_cvtepi32_ps(_mm_cvtps_epi32(a))
+    #define SIMD_CMPLT(a, b) _mm_cmplt_ps(a, b)
+    #define SIMD_CMPEQ(a, b) _mm_cmpeq_ps(a, b)
+    #define SIMD_CMPGE(a, b) _mm_cmpge_ps(a, b)
+    #define SIMD_SELECT(mask, a, b) _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b))
+    #define SIMD_MOVEMASK(mask) _mm_movemask_ps(mask)
+#endif
+
 #define FONT_SIZE         20
 
 #define D_STEP         20.0f
@@ -26,6 +80,9 @@
 #define D_MIN           1.0f
 #define D_MAX       10000.0f
 
+#define STRESS_PARTICLES    500000      // Particles of the tweens stress mode, every particle has a tween for x and y
+#define STRESS_DRAWN        32768       // Particles drawn on the tweens stress mode
+
 // Easing types
 enum EasingTypes {
     EASE_LINEAR_NONE = 0,
@@ -60,8 +117,60 @@ enum EasingTypes {
     EASING_NONE = NUM_EASING_TYPES
 };
 
+// Tween completed on the last update
+typedef struct TweenCompletion {
+    int id;
+    float *target;
+} TweenCompletion;
+
+// Tweens completion callback, receives all the tweens completed on an update at once
+typedef void (*TweenCompleteCallback)(const TweenCompletion *completed, int count, void *userData);
+
+// Tweens of an easing type, stored as structure of arrays
+typedef struct TweenGroup {
+    float *time;            // Current time of every tween
+    float *start;           // Starting value
+    float *change;          // Total change of the value
+    float *duration;        // Total time of the tween
+    float **targets;        // Values updated by the tweens
+    int *ids;
+    int count;
+    int capacity;
+} TweenGroup;
+
+// Tweens manager, active tweens grouped by easing type
+// NOTE: Every group is updated in a single pass, completed tweens are removed after the pass
+// and reported together with one callback call
+typedef struct TweenManager {
+    TweenGroup groups[NUM_EASING_TYPES];
+    int nextId;
+
+    TweenCompletion *completed;         // Tweens completed on the last update
+    int completedCount;
+    int completedCapacity;
+    int *completedIndices;              // Completed tweens of the group being updated
+    int completedIndicesCapacity;
+
+    TweenCompleteCallback onComplete;
+    void *userData;
+} TweenManager;
+
 static float NoEase(float t, float b, float c, float d);  // NoEase function declaration, function used when "no easing" is selected for any axis
 
+// Add a tween to the manager, target value goes from 'from' to 'to' in duration time, returns tween id
+// NOTE: Easing must be one of the easing types (not EASING_NONE) and duration above 0
+static int AddTween(TweenManager *manager, int easing, float *target, float from, float to, float duration);
+// Update all the tweens of the manager, elapsed time in the same unit as the tweens duration
+static void UpdateTweens(TweenManager *manager, float elapsed, bool useSIMD);
+// Get the number of active tweens
+static int GetTweenCount(const TweenManager *manager);
+// Check the tweens values against the reasings functions, returns max difference relative to the tweens change
+static float CheckTweens(const TweenManager *manager, int samplesPerGroup);
+// Unload the tweens manager
+static void UnloadTweenManager(TweenManager *manager);
+// Stress mode tweens completion callback, starts a new tween on every completed target
+static void RestartStressTweens(const TweenCompletion *completed, int count, void *userData);
+
 // Easing functions reference data
 static const struct {
     const char *name;
@@ -120,6 +229,15 @@ int main(void)
     int easingX = EASING_NONE;  // Easing selected for x axis
     int easingY = EASING_NONE;  // Easing selected for y axis
 
+    // Tweens stress mode: particles moved by random tweens, restarted when completed
+    bool stressMode = false;
+    bool useSIMD = true;
+    float *particles = NULL;    // Particles positions, x and y interleaved, normalized to [0..1]
+    TweenManager tweens = { .onComplete = RestartStressTweens };
+    tweens.userData = &tweens;
+    float updateTime = 0.0f;    // Tweens update time, averaged (ms)
+    float maxDifference = 0.0f; // Max difference against reasings functions, relative to tweens change
+
     SetTargetFPS(60);
     //--------------------------------------------------------------------------------------
 
@@ -179,6 +297,34 @@ int main(void)
 
         if (IsKeyPressed(KEY_ENTER)) paused = !paused;
 
+        // Tweens stress mode controls
+        if (IsKeyPressed(KEY_B))
+        {
+            stressMode = !stressMode;
+
+            if (stressMode && (particles == NULL))
+            {
+                particles = (float *)RL_CALLOC(STRESS_PARTICLES*2, sizeof(float));
+
+                for (int i = 0; i < STRESS_PARTICLES*2; i++)
+                {
+                    AddTween(&tweens, GetRandomValue(0, NUM_EASING_TYPES - 1), &particles[i], GetRandomValue(0, 1000)/1000.0f,
+                        GetRandomValue(0, 1000)/1000.0f, (float)GetRandomValue(60, 240));
+                }
+            }
+        }
+
+        if (IsKeyPressed(KEY_V)) useSIMD = !useSIMD;
+
+        if (stressMode)
+        {
+            double updateStartTime = GetTime();
+            UpdateTweens(&tweens, 1.0f, useSIMD);
+            updateTime = updateTime*0.95f + (float)(GetTime() - updateStartTime)*1000.0f*0.05f;
+
+            maxDifference = CheckTweens(&tweens, 64);
+        }
+
         // Movement computation
         if (!paused && ((boundedT && t < d) || !boundedT))
         {
@@ -194,19 +340,36 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            // Draw information text
-            DrawText(TextFormat("Easing x: %s", Easings[easingX].name), 20, FONT_SIZE, FONT_SIZE, LIGHTGRAY);
-            DrawText(TextFormat("Easing y: %s", Easings[easingY].name), 20, FONT_SIZE*2, FONT_SIZE, LIGHTGRAY);
-            DrawText(TextFormat("t (%c) = %.2f d = %.2f", (boundedT == true)? 'b' : 'u', t, d), 20, FONT_SIZE*3, FONT_SIZE, LIGHTGRAY);
-
-            // Draw instructions text
-            DrawText("Use ENTER to play or pause movement, use SPACE to restart", 20, GetScreenHeight() - FONT_SIZE*2, FONT_SIZE, LIGHTGRAY);
-            DrawText("Use Q and W or A and S keys to change duration", 20, GetScreenHeight() - FONT_SIZE*3, FONT_SIZE, LIGHTGRAY);
-            DrawText("Use LEFT or RIGHT keys to choose easing for the x axis", 20, GetScreenHeight() - FONT_SIZE*4, FONT_SIZE, LIGHTGRAY);
-            DrawText("Use UP or DOWN keys to choose easing for the y axis", 20, GetScreenHeight() - FONT_SIZE*5, FONT_SIZE, LIGHTGRAY);
-
-            // Draw ball
-            DrawCircleV(ballPosition, 16.0f, MAROON);
+            if (stressMode)
+            {
+                for (int i = 0; i < STRESS_DRAWN; i++)
+                {
+                    DrawRectangle(20 + (int)(particles[2*i]*(screenWidth - 40)), 100 + (int)(particles[2*i + 1]*(screenHeight - 140)), 2, 2, Fade(MAROON, 0.5f));
+                }
+
+                DrawRectangle(0, 0, screenWidth, 90, Fade(BLACK, 0.8f));
+                DrawText(TextFormat("Tweens: %i - Completed last frame: %i", GetTweenCount(&tweens), tweens.completedCount), 20, 10, FONT_SIZE, RAYWHITE);
+                DrawText(TextFormat("Update (%s): %.2f ms", useSIMD? TextFormat("SIMD %s", TWEEN_SIMD_NAME) : "scalar", updateTime), 20, 10 + FONT_SIZE, FONT_SIZE, RAYWHITE);
+                DrawText(TextFormat("Max difference vs reasings: %.1e", maxDifference), 20, 10 + FONT_SIZE*2, FONT_SIZE, RAYWHITE);
+                DrawText("Use B to exit tweens stress mode, V to switch SIMD", 20, GetScreenHeight() - FONT_SIZE*2, FONT_SIZE, GRAY);
+            }
+            else
+            {
+                // Draw information text
+                DrawText(TextFormat("Easing x: %s", Easings[easingX].name), 20, FONT_SIZE, FONT_SIZE, LIGHTGRAY);
+                DrawText(TextFormat("Easing y: %s", Easings[easingY].name), 20, FONT_SIZE*2, FONT_SIZE, LIGHTGRAY);
+                DrawText(TextFormat("t (%c) = %.2f d = %.2f", (boundedT == true)? 'b' : 'u', t, d), 20, FONT_SIZE*3, FONT_SIZE, LIGHTGRAY);
+
+                // Draw instructions text
+                DrawText("Use ENTER to play or pause movement, use SPACE to restart", 20, GetScreenHeight() - FONT_SIZE*2, FONT_SIZE, LIGHTGRAY);
+                DrawText("Use Q and W or A and S keys to change duration", 20, GetScreenHeight() - FONT_SIZE*3, FONT_SIZE, LIGHTGRAY);
+                DrawText("Use LEFT or RIGHT keys to choose easing for the x axis", 20, GetScreenHeight() - FONT_SIZE*4, FONT_SIZE, LIGHTGRAY);
+                DrawText("Use UP or DOWN keys to choose easing for the y axis", 20, GetScreenHeight() - FONT_SIZE*5, FONT_SIZE, LIGHTGRAY);
+                DrawText("Use B for tweens stress mode", 20, GetScreenHeight() - FONT_SIZE*6, FONT_SIZE, LIGHTGRAY);
+
+                // Draw ball
+                DrawCircleV(ballPosition, 16.0f, MAROON);
+            }
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -214,6 +377,9 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    UnloadTweenManager(&tweens);
+    RL_FREE(particles);
+
     CloseWindow();
     //--------------------------------------------------------------------------------------
 
@@ -231,3 +397,372 @@ static float NoEase(float t, float b, float c, float d)
 
     return b;
 }
+
+// Add a tween to the manager, target value goes from 'from' to 'to' in duration time, returns tween id
+// NOTE: Easing must be one of the easing types (not EASING_NONE) and duration above 0
+static int AddTween(TweenManager *manager, int easing, float *target, float from, float to, float duration)
+{
+    if ((easing < 0) || (easing >= NUM_EASING_TYPES)) return -1;
+
+    TweenGroup *group = &manager->groups[easing];
+
+    if (group->count >= group->capacity)
+    {
+        group->capacity = (group->capacity > 0)? group->capacity*2 : 1024;
+        group->time = (float *)RL_REALLOC(group->time, group->capacity*sizeof(float));
+        group->start = (float *)RL_REALLOC(group->start, group->capacity*sizeof(float));
+        group->change = (float *)RL_REALLOC(group->change, group->capacity*sizeof(float));
+        group->duration = (float *)RL_REALLOC(group->duration, group->capacity*sizeof(float));
+        group->targets = (float **)RL_REALLOC(group->targets, group->capacity*sizeof(float *));
+        group->ids = (int *)RL_REALLOC(group->ids, group->capacity*sizeof(int));
+    }
+
+    int index = group->count;
+    group->time[index] = 0.0f;
+    group->start[index] = from;
+    group->change[index] = to - from;
+    group->duration[index] = duration;
+    group->targets[index] = target;
+    group->ids[index] = manager->nextId;
+    group->count++;
+
+    *target = from;
+
+    return manager->nextId++;
+}
+
+#if (TWEEN_SIMD_WIDTH > 1)
+// Sine of every lane, error below 1e-6
+// NOTE: The angle is reduced to [-PI, PI], folded to [-PI/2, PI/2] with sin(x) = sin(PI - x)
+// and evaluated with the Taylor series up to x^11
+static inline SIMD_FLOAT SimdSin(SIMD_FLOAT x)
+{
+    x = SIMD_SUB(x, SIMD_MUL(SIMD_ROUND(SIMD_MUL(x, SIMD_SET(1.0f/(2.0f*PI)))), SIMD_SET(2.0f*PI)));
+    x = SIMD_MIN(x, SIMD_SUB(SIMD_SET(PI), x));
+    x = SIMD_MAX(x, SIMD_SUB(SIMD_SET(-PI), x));
+
+    SIMD_FLOAT x2 = SIMD_MUL(x, x);
+    SIMD_FLOAT p = SIMD_SET(-1.0f/39916800.0f);
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f/362880.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(-1.0f/5040.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f/120.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(-1.0f/6.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f));
+
+    return SIMD_MUL(p, x);
+}
+
+// Cosine of every lane
+static inline SIMD_FLOAT SimdCos(SIMD_FLOAT x)
+{
+    return SimdSin(SIMD_ADD(x, SIMD_SET(PI/2.0f)));
+}
+
+// Two to the power of every lane, lanes must hold integer values
+// NOTE: Power is built directly on the float exponent bits
+static inline SIMD_FLOAT SimdPow2Integer(SIMD_FLOAT n)
+{
+#if (TWEEN_SIMD_WIDTH == 8)
+    // AVX has no 256 bit integer operations, exponent is built on both 128 bit halves
+    __m128i low = _mm_cvtps_epi32(_mm256_castps256_ps128(n));
+    __m128i high = _mm_cvtps_epi32(_mm256_extractf128_ps(n, 1));
+    low = _mm_slli_epi32(_mm_add_epi32(low, _mm_set1_epi32(127)), 23);
+    high = _mm_slli_epi32(_mm_add_epi32(high, _mm_set1_epi32(127)), 23);
+
+    return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(low)), _mm_castsi128_ps(high), 1);
+#else
+    return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(n), _mm_set1_epi32(127)), 23));
+#endif
+}
+
+// Two to the power of every lane, relative error below 1e-6 for the [-126, 127] range
+// NOTE: Integer part goes to the exponent, fractional part in [-0.5, 0.5] uses the Taylor series up to x^6
+static inline SIMD_FLOAT SimdExp2(SIMD_FLOAT x)
+{
+    SIMD_FLOAT n = SIMD_ROUND(x);
+    SIMD_FLOAT f = SIMD_MUL(SIMD_SUB(x, n), SIMD_SET(0.69314718f));
+
+    SIMD_FLOAT p = SIMD_SET(1.0f/720.0f);
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(1.0f/120.0f));
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(1.0f/24.0f));
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(1.0f/6.0f));
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(0.5f));
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(1.0f));
+    p = SIMD_ADD(SIMD_MUL(p, f), SIMD_SET(1.0f));
+
+    return SIMD_MUL(p, SimdPow2Integer(n));
+}
+
+// Bounce out easing of every lane, normalized time and value
+// NOTE: Bounce parabolas offset and height are selected per lane, then a single parabola is evaluated
+static inline SIMD_FLOAT SimdBounceOut(SIMD_FLOAT p)
+{
+    SIMD_FLOAT offset = SIMD_SET(2.625f/2.75f);
+    SIMD_FLOAT height = SIMD_SET(0.984375f);
+
+    SIMD_FLOAT mask = SIMD_CMPLT(p, SIMD_SET(2.5f/2.75f));
+    offset = SIMD_SELECT(mask, SIMD_SET(2.25f/2.75f), offset);
+    height = SIMD_SELECT(mask, SIMD_SET(0.9375f), height);
+
+    mask = SIMD_CMPLT(p, SIMD_SET(2.0f/2.75f));
+    offset = SIMD_SELECT(mask, SIMD_SET(1.5f/2.75f), offset);
+    height = SIMD_SELECT(mask, SIMD_SET(0.75f), height);
+
+    mask = SIMD_CMPLT(p, SIMD_SET(1.0f/2.75f));
+    offset = SIMD_SELECT(mask, SIMD_SET(0.0f), offset);
+    height = SIMD_SELECT(mask, SIMD_SET(0.0f), height);
+
+    SIMD_FLOAT q = SIMD_SUB(p, offset);
+
+    return SIMD_ADD(SIMD_MUL(SIMD_SET(7.5625f), SIMD_MUL(q, q)), height);
+}
+
+// Easing of every lane, normalized time (t/d) and value (0 at start, 1 at end)
+// NOTE: Same curves as the reasings functions, ease(t, b, c, d) = b + c*EaseSIMD(t/d),
+// both halves of in-out easings are evaluated and selected per lane
+static inline SIMD_FLOAT EaseSIMD(int easing, SIMD_FLOAT p)
+{
+    const SIMD_FLOAT zero = SIMD_SET(0.0f);
+    const SIMD_FLOAT one = SIMD_SET(1.0f);
+    const SIMD_FLOAT half = SIMD_SET(0.5f);
+    const SIMD_FLOAT two = SIMD_SET(2.0f);
+    const SIMD_FLOAT start = SIMD_CMPEQ(p, zero);
+    const SIMD_FLOAT end = SIMD_CMPEQ(p, one);
+
+    SIMD_FLOAT u = SIMD_MUL(p, two);                // In-out easings time, first half below 1
+    SIMD_FLOAT firstHalf = SIMD_CMPLT(u, one);
+    SIMD_FLOAT q = SIMD_SUB(p, one);
+
+    switch (easing)
+    {
+        case EASE_SINE_IN: return SIMD_SUB(one, SimdCos(SIMD_MUL(p, SIMD_SET(PI/2.0f))));
+        case EASE_SINE_OUT: return SimdSin(SIMD_MUL(p, SIMD_SET(PI/2.0f)));
+        case EASE_SINE_IN_OUT: return SIMD_MUL(half, SIMD_SUB(one, SimdCos(SIMD_MUL(p, SIMD_SET(PI)))));
+        case EASE_CIRC_IN: return SIMD_SUB(one, SIMD_SQRT(SIMD_MAX(zero, SIMD_SUB(one, SIMD_MUL(p, p)))));
+        case EASE_CIRC_OUT: return SIMD_SQRT(SIMD_MAX(zero, SIMD_SUB(one, SIMD_MUL(q, q))));
+        case EASE_CIRC_IN_OUT:
+        {
+            SIMD_FLOAT v = SIMD_SELECT(firstHalf, u, SIMD_SUB(u, two));
+            SIMD_FLOAT root = SIMD_SQRT(SIMD_MAX(zero, SIMD_SUB(one, SIMD_MUL(v, v))));
+            return SIMD_MUL(half, SIMD_SELECT(firstHalf, SIMD_SUB(one, root), SIMD_ADD(root, one)));
+        }
+        case EASE_CUBIC_IN: return SIMD_MUL(SIMD_MUL(p, p), p);
+        case EASE_CUBIC_OUT: return SIMD_ADD(SIMD_MUL(SIMD_MUL(q, q), q), one);
+        case EASE_CUBIC_IN_OUT:
+        {
+            SIMD_FLOAT v = SIMD_SELECT(firstHalf, u, SIMD_SUB(u, two));
+            SIMD_FLOAT cube = SIMD_MUL(SIMD_MUL(v, v), v);
+            return SIMD_MUL(half, SIMD_SELECT(firstHalf, cube, SIMD_ADD(cube, two)));
+        }
+        case EASE_QUAD_IN: return SIMD_MUL(p, p);
+        case EASE_QUAD_OUT: return SIMD_MUL(p, SIMD_SUB(two, p));
+        case EASE_QUAD_IN_OUT:
+        {
+            SIMD_FLOAT second = SIMD_SUB(one, SIMD_MUL(SIMD_SUB(u, one), SIMD_SUB(u, SIMD_SET(3.0f))));
+            return SIMD_MUL(half, SIMD_SELECT(firstHalf, SIMD_MUL(u, u), second));
+        }
+        case EASE_EXPO_IN: return SIMD_SELECT(start, zero, SimdExp2(SIMD_MUL(SIMD_SET(10.0f), q)));
+        case EASE_EXPO_OUT: return SIMD_SELECT(end, one, SIMD_SUB(one, SimdExp2(SIMD_MUL(SIMD_SET(-10.0f), p))));
+        case EASE_EXPO_IN_OUT:
+        {
+            SIMD_FLOAT exponent = SIMD_MUL(SIMD_SET(10.0f), SIMD_SUB(u, one));
+            SIMD_FLOAT power = SimdExp2(SIMD_SELECT(firstHalf, exponent, SIMD_SUB(zero, exponent)));
+            SIMD_FLOAT value = SIMD_MUL(half, SIMD_SELECT(firstHalf, power, SIMD_SUB(two, power)));
+            return SIMD_SELECT(end, one, SIMD_SELECT(start, zero, value));
+        }
+        case EASE_BACK_IN: return SIMD_MUL(SIMD_MUL(p, p), SIMD_SUB(SIMD_MUL(SIMD_SET(1.70158f + 1.0f), p), SIMD_SET(1.70158f)));
+        case EASE_BACK_OUT: return SIMD_ADD(SIMD_MUL(SIMD_MUL(q, q), SIMD_ADD(SIMD_MUL(SIMD_SET(1.70158f + 1.0f), q), SIMD_SET(1.70158f))), one);
+        case EASE_BACK_IN_OUT:
+        {
+            const float s = 1.70158f*1.525f;
+            SIMD_FLOAT v = SIMD_SELECT(firstHalf, u, SIMD_SUB(u, two));
+            SIMD_FLOAT back = SIMD_MUL(SIMD_MUL(v, v), SIMD_ADD(SIMD_MUL(SIMD_SET(s + 1.0f), v), SIMD_SELECT(firstHalf, SIMD_SET(-s), SIMD_SET(s))));
+            return SIMD_MUL(half, SIMD_SELECT(firstHalf, back, SIMD_ADD(back, two)));
+        }
+        case EASE_BOUNCE_OUT: return SimdBounceOut(p);
+        case EASE_BOUNCE_IN: return SIMD_SUB(one, SimdBounceOut(SIMD_SUB(one, p)));
+        case EASE_BOUNCE_IN_OUT:
+        {
+            SIMD_FLOAT bounce = SimdBounceOut(SIMD_SELECT(firstHalf, SIMD_SUB(one, u), SIMD_SUB(u, one)));
+            return SIMD_MUL(half, SIMD_SELECT(firstHalf, SIMD_SUB(one, bounce), SIMD_ADD(bounce, one)));
+        }
+        case EASE_ELASTIC_IN:
+        {
+            SIMD_FLOAT wave = SimdSin(SIMD_MUL(SIMD_SUB(q, SIMD_SET(0.075f)), SIMD_SET(2.0f*PI/0.3f)));
+            SIMD_FLOAT value = SIMD_SUB(zero, SIMD_MUL(SimdExp2(SIMD_MUL(SIMD_SET(10.0f), q)), wave));
+            return SIMD_SELECT(end, one, SIMD_SELECT(start, zero, value));
+        }
+        case EASE_ELASTIC_OUT:
+        {
+            SIMD_FLOAT wave = SimdSin(SIMD_MUL(SIMD_SUB(p, SIMD_SET(0.075f)), SIMD_SET(2.0f*PI/0.3f)));
+            SIMD_FLOAT value = SIMD_ADD(SIMD_MUL(SimdExp2(SIMD_MUL(SIMD_SET(-10.0f), p)), wave), one);
+            return SIMD_SELECT(end, one, SIMD_SELECT(start, zero, value));
+        }
+        case EASE_ELASTIC_IN_OUT:
+        {
+            SIMD_FLOAT v = SIMD_SUB(u, one);
+            SIMD_FLOAT exponent = SIMD_MUL(SIMD_SET(10.0f), v);
+            SIMD_FLOAT wave = SimdSin(SIMD_MUL(SIMD_SUB(v, SIMD_SET(0.1125f)), SIMD_SET(2.0f*PI/0.45f)));
+            SIMD_FLOAT elastic = SIMD_MUL(SIMD_MUL(SimdExp2(SIMD_SELECT(firstHalf, exponent, SIMD_SUB(zero, exponent))), wave), half);
+            SIMD_FLOAT value = SIMD_SELECT(firstHalf, SIMD_SUB(zero, elastic), SIMD_ADD(elastic, one));
+            return SIMD_SELECT(end, one, SIMD_SELECT(start, zero, value));
+        }
+        default: return p;      // Linear easings
+    }
+}
+#endif
+
+// Update the tweens of an easing type group, completed tweens are removed from the group
+static void UpdateTweenGroup(TweenManager *manager, int easing, float elapsed, bool useSIMD)
+{
+    TweenGroup *group = &manager->groups[easing];
+
+    if (manager->completedIndicesCapacity < group->count)
+    {
+        manager->completedIndicesCapacity = group->count;
+        manager->completedIndices = (int *)RL_REALLOC(manager->completedIndices, manager->completedIndicesCapacity*sizeof(int));
+    }
+
+    int completedCount = 0;
+    int i = 0;
+
+#if (TWEEN_SIMD_WIDTH > 1)
+    if (useSIMD)
+    {
+        const SIMD_FLOAT step = SIMD_SET(elapsed);
+        float values[TWEEN_SIMD_WIDTH] = { 0 };
+
+        for (; i <= (group->count - TWEEN_SIMD_WIDTH); i += TWEEN_SIMD_WIDTH)
+        {
+            SIMD_FLOAT duration = SIMD_LOAD(group->duration + i);
+            SIMD_FLOAT time = SIMD_MIN(SIMD_ADD(SIMD_LOAD(group->time + i), step), duration);
+            SIMD_STORE(group->time + i, time);
+
+            SIMD_FLOAT ease = EaseSIMD(easing, SIMD_DIV(time, duration));
+            SIMD_STORE(values, SIMD_ADD(SIMD_LOAD(group->start + i), SIMD_MUL(SIMD_LOAD(group->change + i), ease)));
+            for (int k = 0; k < TWEEN_SIMD_WIDTH; k++) *group->targets[i + k] = values[k];
+
+            int completed = SIMD_MOVEMASK(SIMD_CMPGE(time, duration));
+            if (completed != 0)
+            {
+                for (int k = 0; k < TWEEN_SIMD_WIDTH; k++)
+                {
+                    if (completed & (1 << k)) manager->completedIndices[completedCount++] = i + k;
+                }
+            }
+        }
+    }
+#endif
+
+    // Remaining tweens or scalar update, with the reasings functions
+    for (; i < group->count; i++)
+    {
+        float time = fminf(group->time[i] + elapsed, group->duration[i]);
+        group->time[i] = time;
+
+        *group->targets[i] = Easings[easing].func(time, group->start[i], group->change[i], group->duration[i]);
+
+        if (time >= group->duration[i]) manager->completedIndices[completedCount++] = i;
+    }
+
+    if ((manager->completedCount + completedCount) > manager->completedCapacity)
+    {
+        while (manager->completedCapacity < (manager->completedCount + completedCount)) manager->completedCapacity = (manager->completedCapacity > 0)? manager->completedCapacity*2 : 1024;
+        manager->completed = (TweenCompletion *)RL_REALLOC(manager->completed, manager->completedCapacity*sizeof(TweenCompletion));
+    }
+
+    // Remove completed tweens, last tween of the group takes the place of every removed one
+    // NOTE: Removed from the last one, so the tween moved is never a completed one
+    for (int c = completedCount - 1; c >= 0; c--)
+    {
+        int index = manager->completedIndices[c];
+        int last = group->count - 1;
+
+        manager->completed[manager->completedCount] = (TweenCompletion){ group->ids[index], group->targets[index] };
+        manager->completedCount++;
+
+        group->time[index] = group->time[last];
+        group->start[index] = group->start[last];
+        group->change[index] = group->change[last];
+        group->duration[index] = group->duration[last];
+        group->targets[index] = group->targets[last];
+        group->ids[index] = group->ids[last];
+        group->count--;
+    }
+}
+
+// Update all the tweens of the manager, elapsed time in the same unit as the tweens duration
+// NOTE: Completion callback is called once after all groups are updated, new tweens can be added from it
+static void UpdateTweens(TweenManager *manager, float elapsed, bool useSIMD)
+{
+    manager->completedCount = 0;
+
+    for (int easing = 0; easing < NUM_EASING_TYPES; easing++) UpdateTweenGroup(manager, easing, elapsed, useSIMD);
+
+    if ((manager->completedCount > 0) && (manager->onComplete != NULL)) manager->onComplete(manager->completed, manager->completedCount, manager->userData);
+}
+
+// Get the number of active tweens
+static int GetTweenCount(const TweenManager *manager)
+{
+    int count = 0;
+
+    for (int easing = 0; easing < NUM_EASING_TYPES; easing++) count += manager->groups[easing].count;
+
+    return count;
+}
+
+// Check the tweens values against the reasings functions, returns max difference relative to the tweens change
+// NOTE: Only the first samplesPerGroup tweens of every group are checked
+static float CheckTweens(const TweenManager *manager, int samplesPerGroup)
+{
+    float maxDifference = 0.0f;
+
+    for (int easing = 0; easing < NUM_EASING_TYPES; easing++)
+    {
+        const TweenGroup *group = &manager->groups[easing];
+
+        for (int i = 0; (i < group->count) && (i < samplesPerGroup); i++)
+        {
+            float expected = Easings[easing].func(group->time[i], group->start[i], group->change[i], group->duration[i]);
+            float difference = fabsf(*group->targets[i] - expected)/fmaxf(fabsf(group->change[i]), 1e-6f);
+
+            if (difference > maxDifference) maxDifference = difference;
+        }
+    }
+
+    return maxDifference;
+}
+
+// Unload the tweens manager
+static void UnloadTweenManager(TweenManager *manager)
+{
+    for (int easing = 0; easing < NUM_EASING_TYPES; easing++)
+    {
+        TweenGroup *group = &manager->groups[easing];
+
+        RL_FREE(group->time);
+        RL_FREE(group->start);
+        RL_FREE(group->change);
+        RL_FREE(group->duration);
+        RL_FREE(group->targets);
+        RL_FREE(group->ids);
+    }
+
+    RL_FREE(manager->completed);
+    RL_FREE(manager->completedIndices);
+
+    *manager = (TweenManager){ 0 };
+}
+
+// Stress mode tweens completion callback, starts a new tween on every completed target
+static void RestartStressTweens(const TweenCompletion *completed, int count, void *userData)
+{
+    TweenManager *manager = (TweenManager *)userData;
+
+    for (int i = 0; i < count; i++)
+    {
+        AddTween(manager, GetRandomValue(0, NUM_EASING_TYPES - 1), completed[i].target, *completed[i].target,
+            GetRandomValue(0, 1000)/1000.0f, (float)GetRandomValue(60, 240));
+    }
+}
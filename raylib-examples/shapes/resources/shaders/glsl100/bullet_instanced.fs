@@ -0,0 +1,16 @@
+#version 100
+
+precision mediump float;
+
+// Input vertex attributes (from vertex shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;
+
+void main()
+{
+    // Bullet texture tinted with the bullet color
+    gl_FragColor = texture2D(texture0, fragTexCoord)*fragColor;
+}
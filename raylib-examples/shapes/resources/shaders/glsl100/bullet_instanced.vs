@@ -0,0 +1,30 @@
+#version 100
+
+// Input vertex attributes, corner of the bullet quad in [0..1]
+attribute vec2 vertexPosition;
+
+// Input instance attributes, one bullet per instance
+attribute float instancePositionX;
+attribute float instancePositionY;
+attribute vec4 instanceColor;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform float bulletSize;
+
+// Output vertex attributes (to fragment shader)
+varying vec2 fragTexCoord;
+varying vec4 fragColor;
+
+void main()
+{
+    // Send vertex attributes to fragment shader
+    fragTexCoord = vertexPosition;
+    fragColor = instanceColor;
+
+    // Bullet quad centered on the bullet position, snapped to pixels like DrawTexture()
+    vec2 position = floor(vec2(instancePositionX, instancePositionY) - 0.5*bulletSize) + vertexPosition*bulletSize;
+
+    // Calculate final vertex position
+    gl_Position = mvp*vec4(position, 0.0, 1.0);
+}
@@ -0,0 +1,17 @@
+#version 330
+
+// Input vertex attributes (from vertex shader)
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+// Input uniform values
+uniform sampler2D texture0;
+
+// Output fragment color
+out vec4 finalColor;
+
+void main()
+{
+    // Bullet texture tinted with the bullet color
+    finalColor = texture(texture0, fragTexCoord)*fragColor;
+}
@@ -0,0 +1,30 @@
+#version 330
+
+// Input vertex attributes, corner of the bullet quad in [0..1]
+in vec2 vertexPosition;
+
+// Input instance attributes, one bullet per instance
+in float instancePositionX;
+in float instancePositionY;
+in vec4 instanceColor;
+
+// Input uniform values
+uniform mat4 mvp;
+uniform float bulletSize;
+
+// Output vertex attributes (to fragment shader)
+out vec2 fragTexCoord;
+out vec4 fragColor;
+
+void main()
+{
+    // Send vertex attributes to fragment shader
+    fragTexCoord = vertexPosition;
+    fragColor = instanceColor;
+
+    // Bullet quad centered on the bullet position, snapped to pixels like DrawTexture()
+    vec2 position = floor(vec2(instancePositionX, instancePositionY) - 0.5*bulletSize) + vertexPosition*bulletSize;
+
+    // Calculate final vertex position
+    gl_Position = mvp*vec4(position, 0.0, 1.0);
+}
@@ -17,20 +17,225 @@
 
 #include "raylib.h"
 
+#include "rlgl.h"
+#include "raymath.h"        // Required for: MatrixMultiply()
+
 #include <stdlib.h>         // Required for: calloc(), free()
-#include <math.h>           // Required for: cosf(), sinf()
+#include <string.h>         // Required for: memset()
+#include <math.h>           // Required for: cosf(), sinf(), ceilf(), floorf()
+#include <stdatomic.h>      // Required for: atomic_compare_exchange_weak()
+
+#include "pthread.h"        // POSIX style threads management
+
+#if !defined(_WIN32)
+    #include <unistd.h>     // Required for: sysconf()
+#endif
+
+#if defined(PLATFORM_DESKTOP)
+    #define GLSL_VERSION            330
+#else   // PLATFORM_ANDROID, PLATFORM_WEB
+    #define GLSL_VERSION            100
+#endif
+
+// Update kernel instruction set, selected at compile time (-mavx enables the 8-wide path)
+#if defined(__AVX__)
+    #include <immintrin.h>  // Required for: AVX intrinsics
+    #define BULLET_SIMD_WIDTH 8
+    #define BULLET_SIMD_NAME "AVX"
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #define BULLET_SIMD_WIDTH 4
+    #define BULLET_SIMD_NAME "SSE2"
+#else
+    #define BULLET_SIMD_WIDTH 1     // No SIMD instruction set available, the SIMD path runs the scalar kernel
+    #define BULLET_SIMD_NAME "none"
+#endif
+
+// SIMD operations used by the update kernels, BULLET_SIMD_WIDTH lanes
+#if (BULLET_SIMD_WIDTH == 8)
+    #define SIMD_FLOAT __m256
+    #define SIMD_INT __m256i
+    #define SIMD_SET(value) _mm256_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm256_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm256_storeu_ps(ptr, value)
+    #define SIMD_LOAD_INT(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+    #define SIMD_STORE_INT(ptr, value) _mm256_storeu_si256((__m256i *)(ptr), value)
+    #define SIMD_ADD(a, b) _mm256_add_ps(a, b)
+    #define SIMD_AND(a, b) _mm256_and_ps(a, b)
+    #define SIMD_GE(a, b) _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+    #define SIMD_LE(a, b) _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+    #define SIMD_MASK(a) _mm256_movemask_ps(a)
+#elif (BULLET_SIMD_WIDTH == 4)
+    #define SIMD_FLOAT __m128
+    #define SIMD_INT __m128i
+    #define SIMD_SET(value) _mm_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm_storeu_ps(ptr, value)
+    #define SIMD_LOAD_INT(ptr) _mm_loadu_si128((const __m128i *)(ptr))
+    #define SIMD_STORE_INT(ptr, value) _mm_storeu_si128((__m128i *)(ptr), value)
+    #define SIMD_ADD(a, b) _mm_add_ps(a, b)
+    #define SIMD_AND(a, b) _mm_and_ps(a, b)
+    #define SIMD_GE(a, b) _mm_cmpge_ps(a, b)
+    #define SIMD_LE(a, b) _mm_cmple_ps(a, b)
+    #define SIMD_MASK(a) _mm_movemask_ps(a)
+#endif
 
 #define MAX_BULLETS 500000      // Max bullets to be processed
 
+#define BULLET_INSTANCE_BUFFERS 3   // Instance buffers written in turns, the GPU can still be reading the previous ones
+
+#define MAX_JOB_WORKERS 32      // Max threads running the bullets update, the main thread included
+#define BULLET_CHUNK_SIZE 8192  // Bullets updated per job, 160 KB of bullet data that fits in the L2 cache
+
+#define BULLET_GRID_CELL_SIZE 16    // Collision grid cell size (pixels), smaller cells test fewer bullets per query
+#define PLAYER_HITBOX_RADIUS 4      // Player hitbox, much smaller than the player sprite
+#define STRESS_PLAYERS 2000         // Players tested against the bullets on collision stress mode
+
+#define BENCHMARK_BULLETS 1000000   // Bullets updated by the benchmark
+#define BENCHMARK_FRAMES 30         // Updates timed per path by the benchmark
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-typedef struct Bullet {
-    Vector2 position;       // Bullet position on screen
-    Vector2 acceleration;   // Amount of pixels to be incremented to position every frame
-    bool disabled;          // Skip processing and draw case out of screen
-    Color color;            // Bullet color
-} Bullet;
+// Bullets pool, every bullet component is stored in its own array (structure of arrays)
+// so the update kernel streams through contiguous floats, 4 or 8 bullets per instruction
+// NOTE: Live bullets are kept dense in [0, count), out of screen bullets are compacted away on update
+typedef struct BulletPool {
+    float *positionX;       // Bullet position on screen
+    float *positionY;
+    float *accelerationX;   // Amount of pixels to be incremented to position every frame
+    float *accelerationY;
+    Color *color;           // Bullet color
+    int count;              // Live bullets
+    int capacity;
+} BulletPool;
+
+// Bullets draw method
+typedef enum {
+    DRAW_MODE_CIRCLES = 0,  // DrawCircle() per bullet
+    DRAW_MODE_TEXTURES,     // DrawTexture() per bullet, pre-rendered circle
+    DRAW_MODE_INSTANCED,    // One instanced draw call for all the bullets
+    DRAW_MODE_COUNT
+} BulletDrawMode;
+
+// Instanced bullets renderer, every bullet is an instance of the same textured quad
+// NOTE: Instance attributes are read straight from the pool arrays, the buffers of
+// every set are uploaded with the live bullets once per frame
+typedef struct BulletRenderer {
+    Shader shader;
+    int mvpLoc;
+    int textureLoc;
+    int sizeLoc;
+    unsigned int quadVboId;                                 // Quad corners, shared by all sets
+    unsigned int vaoId[BULLET_INSTANCE_BUFFERS];
+    unsigned int positionXVboId[BULLET_INSTANCE_BUFFERS];   // Instance attributes, one buffer per pool array
+    unsigned int positionYVboId[BULLET_INSTANCE_BUFFERS];
+    unsigned int colorVboId[BULLET_INSTANCE_BUFFERS];
+    int current;            // Buffers set used by the next draw
+    int capacity;           // Max instances per draw
+    bool ready;             // Shader and instance attributes available
+} BulletRenderer;
+
+// Uniform grid over the bullets area, rebuilt every frame to query the bullets near a point
+// NOTE: Bullets are sorted by cell with a counting sort, the bullets of a cell are
+// bulletIndex[cellStart[cell]] to bulletIndex[cellStart[cell + 1] - 1]
+typedef struct BulletGrid {
+    Rectangle bounds;       // Area covered by the grid, bullets out of it are clamped to the border cells
+    float cellSize;
+    int columns;
+    int rows;
+    int *cellStart;         // First sorted bullet of every cell, columns*rows + 1 entries
+    int *bulletIndex;       // Bullets sorted by cell, pool indices
+    int *bulletCell;        // Cell of every pool bullet, computed by the counting pass
+    int capacity;
+} BulletGrid;
+
+// Player moving around the screen, used to stress the collision queries
+typedef struct Player {
+    Vector2 position;
+    Vector2 speed;
+    bool hit;               // Any bullet overlapping the hitbox on the last query
+} Player;
+
+// Bullets update kernel, moves input bullets [start, start + count) and writes the ones still in bounds to output from offset
+typedef int (*BulletKernel)(const BulletPool *input, int start, int count, BulletPool *output, int offset, Rectangle bounds);
+
+typedef void (*JobFunc)(void *data, int job);
+
+// Job system worker, the jobs of a batch are split in one range per worker
+// NOTE: Both ends of the range are packed in one atomic value, so the owner taking a job from the
+// front and a thief stealing one from the back are both a single compare-and-swap
+typedef struct JobWorker {
+    _Atomic unsigned long long range;   // First job (low 32 bits) and end job (high 32 bits) not taken yet
+    double busyTime;        // Time spent running jobs since the last stats reset (ms)
+    int jobsRun;            // Jobs run since the last stats reset...
+    int jobsStolen;         // ...of which stolen from other workers
+    int index;
+    pthread_t thread;
+} JobWorker;
+
+// Work-stealing job system, the thread submitting a batch runs as worker 0
+typedef struct JobSystem {
+    JobWorker workers[MAX_JOB_WORKERS];
+    int workerCount;        // Workers available, threads started + 1
+    int activeCount;        // Workers running the next batches
+    JobFunc func;           // Job of the current batch...
+    void *data;             // ...and its data
+    unsigned int batch;     // Protected by mutex, increased for every batch
+    int pending;            // Protected by mutex, workers still running the current batch
+    bool quit;              // Protected by mutex
+    pthread_mutex_t mutex;
+    pthread_cond_t batchStarted;
+    pthread_cond_t batchDone;
+} JobSystem;
+
+// Multithreaded bullets update, the pool is split in chunks updated by the job system workers
+// NOTE: A first batch counts the bullets of every chunk still in bounds after the move, the prefix sum
+// of the counts gives every chunk its position in the output pool, then a second batch moves the chunks
+// into the output pool with the single-threaded kernel. The result is the same as the single-threaded update
+typedef struct BulletJobs {
+    BulletPool *pool;
+    BulletPool output;      // Update target, swapped with the pool once the update is done
+    Rectangle bounds;
+    BulletKernel kernel;
+    int *chunkLive;         // Live bullets of every chunk after the move...
+    int *chunkOffset;       // ...and their position in the output pool
+    int chunkCount;
+} BulletJobs;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+static BulletPool LoadBulletPool(int capacity);
+static void UnloadBulletPool(BulletPool *pool);
+static void SpawnBullet(BulletPool *pool, Vector2 position, Vector2 acceleration, Color color);
+static int MoveBulletsScalar(const BulletPool *input, int start, int count, BulletPool *output, int offset, Rectangle bounds);
+static int MoveBulletsSIMD(const BulletPool *input, int start, int count, BulletPool *output, int offset, Rectangle bounds);
+static int UpdateBulletsScalar(BulletPool *pool, Rectangle bounds);
+static int UpdateBulletsSIMD(BulletPool *pool, Rectangle bounds);
+static float BenchmarkBulletsUpdate(int (*update)(BulletPool *, Rectangle), Rectangle bounds, int screenWidth, int screenHeight);
+
+static BulletRenderer LoadBulletRenderer(int capacity);
+static void UnloadBulletRenderer(BulletRenderer *renderer);
+static void DrawBulletsInstanced(BulletRenderer *renderer, const BulletPool *pool, Texture2D texture);
+
+static BulletGrid LoadBulletGrid(Rectangle bounds, float cellSize, int capacity);
+static void UnloadBulletGrid(BulletGrid *grid);
+static void UpdateBulletGrid(BulletGrid *grid, const BulletPool *pool);
+static int CheckCollisionBulletGrid(const BulletGrid *grid, const BulletPool *pool, Vector2 center, float radius, int *tested);
+
+static int NextBenchmarkThreads(int threads, int workerCount);
+
+static void StartJobSystem(int workerCount);
+static void StopJobSystem(void);
+static void RunJobs(JobFunc func, void *data, int jobCount);
+static int UpdateBulletsParallel(BulletPool *pool, Rectangle bounds);
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static JobSystem jobs = { 0 };
+static BulletJobs bulletJobs = { 0 };
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -45,14 +250,15 @@ int main(void)
     InitWindow(screenWidth, screenHeight, "raylib [shapes] example - bullet hell");
 
     // Bullets definition
-    Bullet *bullets = (Bullet *)RL_CALLOC(MAX_BULLETS, sizeof(Bullet)); // Bullets array
-    int bulletCount = 0;
-    int bulletDisabledCount = 0; // Used to calculate how many bullets are on screen
+    BulletPool bullets = LoadBulletPool(MAX_BULLETS);
     int bulletRadius = 10;
     float bulletSpeed = 3.0f;
     int bulletRows = 6;
     Color bulletColor[2] = { RED, BLUE };
 
+    // Bullets out of this area are disabled
+    Rectangle bulletBounds = { -bulletRadius*2.0f, -bulletRadius*2.0f, screenWidth + bulletRadius*4.0f, screenHeight + bulletRadius*4.0f };
+
     // Spawner variables
     float baseDirection = 0;
     int angleIncrement = 5; // After spawn all bullet rows, increment this value on the baseDirection for next the frame
@@ -72,7 +278,51 @@ int main(void)
         DrawCircleLines(12, 12, (float)bulletRadius, BLACK);
     EndTextureMode();
 
-    bool drawInPerformanceMode = true; // Switch between DrawCircle() and DrawTexture()
+    // Used on instanced drawing, same texture for all the bullets
+    BulletRenderer bulletRenderer = LoadBulletRenderer(MAX_BULLETS);
+
+    int drawMode = DRAW_MODE_TEXTURES; // Switch between DrawCircle(), DrawTexture() and instanced drawing
+    float drawTime[DRAW_MODE_COUNT] = { 0 };    // Bullets draw time of every method, averaged (ms)
+    float frameTime[DRAW_MODE_COUNT] = { 0 };   // Frame time of every method, averaged (ms)
+    int lastDrawMode = drawMode;       // Method that drew the last frame
+    bool frameLimit = true;
+    bool updateWithSIMD = true;        // Switch between the SIMD and the scalar update kernel
+    bool updateWithThreads = true;     // Split the update across the job system workers
+    double updateTime = 0.0;           // Time of the last bullets update (ms)
+
+    // Job system, one worker per core
+#if defined(_SC_NPROCESSORS_ONLN)
+    int coreCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    int coreCount = 4;
+#endif
+    StartJobSystem((coreCount < MAX_JOB_WORKERS)? coreCount : MAX_JOB_WORKERS);
+
+    // Collision grid over the bullets area
+    BulletGrid bulletGrid = LoadBulletGrid(bulletBounds, BULLET_GRID_CELL_SIZE, MAX_BULLETS);
+    double gridTime = 0.0;             // Time of the last grid rebuild (ms)
+
+    // Player follows the mouse, on stress mode many players wander around the screen instead
+    Player *players = (Player *)RL_CALLOC(STRESS_PLAYERS, sizeof(Player));
+    for (int i = 0; i < STRESS_PLAYERS; i++)
+    {
+        players[i].position = (Vector2){ (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(0, screenHeight) };
+        players[i].speed = (Vector2){ GetRandomValue(-200, 200)/100.0f, GetRandomValue(-200, 200)/100.0f };
+    }
+    bool collisionStressMode = false;
+    int playerHits = 0;                // Frames with the player hit
+
+    // Collision queries stats of the last frame
+    int queryCount = 0;
+    int queryHits = 0;
+    int queryTested = 0;               // Bullets tested against the hitboxes, the bullets in the cells near them
+    double queryTime = 0.0;            // Time of all the queries (ms)
+    double bruteForceTime = 0.0;       // Time of one query testing all the bullets (ms), for reference
+
+    // Update benchmark results, bullets updated per millisecond
+    float benchmarkScalar = 0.0f;
+    float benchmarkSIMD = 0.0f;
+    float benchmarkThreads[MAX_JOB_WORKERS + 1] = { 0 };   // SIMD kernel with 1 to workerCount threads
 
     SetTargetFPS(60);
     //--------------------------------------------------------------------------------------
@@ -82,67 +332,95 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
-        // Reset the bullet index
-        // New bullets will replace the old ones that are already disabled due to out-of-screen
-        if (bulletCount >= MAX_BULLETS)
-        {
-            bulletCount = 0;
-            bulletDisabledCount = 0;
-        }
+        // Frame time of the method that drew the last frame, smoothed over the last few frames
+        frameTime[lastDrawMode] += (GetFrameTime()*1000.0f - frameTime[lastDrawMode])*0.1f;
 
         spawnCooldownTimer--;
         if (spawnCooldownTimer < 0)
         {
             spawnCooldownTimer = spawnCooldown;
 
-            // Spawn bullets
+            // Spawn bullets, new bullets are skipped while the pool is full
             float degreesPerRow = 360.0f/bulletRows;
             for (int row = 0; row < bulletRows; row++)
             {
-                if (bulletCount < MAX_BULLETS)
-                {
-                    bullets[bulletCount].position = (Vector2){(float) screenWidth/2, (float) screenHeight/2};
-                    bullets[bulletCount].disabled = false;
-                    bullets[bulletCount].color = bulletColor[row%2];
-
-                    float bulletDirection = baseDirection + (degreesPerRow*row);
-
-                    // Bullet speed * bullet direction, this will determine how much pixels will be incremented/decremented
-                    // from the bullet position every frame. Since the bullets doesn't change its direction and speed,
-                    // only need to calculate it at the spawning time
-                    // 0 degrees = right, 90 degrees = down, 180 degrees = left and 270 degrees = up, basically clockwise
-                    // Case you want it to be anti-clockwise, add "* -1" at the y acceleration
-                    bullets[bulletCount].acceleration = (Vector2){
-                        bulletSpeed*cosf(bulletDirection*DEG2RAD),
-                        bulletSpeed*sinf(bulletDirection*DEG2RAD)
-                    };
-
-                    bulletCount++;
-                }
+                float bulletDirection = baseDirection + (degreesPerRow*row);
+
+                // Bullet speed * bullet direction, this will determine how much pixels will be incremented/decremented
+                // from the bullet position every frame. Since the bullets doesn't change its direction and speed,
+                // only need to calculate it at the spawning time
+                // 0 degrees = right, 90 degrees = down, 180 degrees = left and 270 degrees = up, basically clockwise
+                // Case you want it to be anti-clockwise, add "* -1" at the y acceleration
+                Vector2 acceleration = {
+                    bulletSpeed*cosf(bulletDirection*DEG2RAD),
+                    bulletSpeed*sinf(bulletDirection*DEG2RAD)
+                };
+
+                SpawnBullet(&bullets, (Vector2){ (float)screenWidth/2, (float)screenHeight/2 }, acceleration, bulletColor[row%2]);
             }
 
             baseDirection += angleIncrement;
         }
 
-        // Update bullets position based on its acceleration
-        for (int i = 0; i < bulletCount; i++)
+        // Update bullets position based on its acceleration, out of screen bullets are removed
+        double updateStartTime = GetTime();
+        bulletJobs.kernel = updateWithSIMD? MoveBulletsSIMD : MoveBulletsScalar;
+        if (updateWithThreads) UpdateBulletsParallel(&bullets, bulletBounds);
+        else if (updateWithSIMD) UpdateBulletsSIMD(&bullets, bulletBounds);
+        else UpdateBulletsScalar(&bullets, bulletBounds);
+        updateTime = (GetTime() - updateStartTime)*1000.0;
+
+        // Sort the bullets in the collision grid
+        double gridStartTime = GetTime();
+        UpdateBulletGrid(&bulletGrid, &bullets);
+        gridTime = (GetTime() - gridStartTime)*1000.0;
+
+        // Check the players hitbox against the bullets, only the bullets in the cells near every player are tested
+        if (collisionStressMode)
         {
-            // Only update bullet if inside the screen
-            if (!bullets[i].disabled)
+            for (int i = 0; i < STRESS_PLAYERS; i++)
             {
-                bullets[i].position.x += bullets[i].acceleration.x;
-                bullets[i].position.y += bullets[i].acceleration.y;
-
-                // Disable bullet if out of screen
-                if ((bullets[i].position.x < -bulletRadius*2) ||
-                    (bullets[i].position.x > screenWidth + bulletRadius*2) ||
-                    (bullets[i].position.y < -bulletRadius*2) ||
-                    (bullets[i].position.y > screenHeight + bulletRadius*2))
-                {
-                    bullets[i].disabled = true;
-                    bulletDisabledCount++;
-                }
+                Player *player = &players[i];
+                player->position.x += player->speed.x;
+                player->position.y += player->speed.y;
+                if ((player->position.x < 0) || (player->position.x > screenWidth)) player->speed.x *= -1;
+                if ((player->position.y < 0) || (player->position.y > screenHeight)) player->speed.y *= -1;
+            }
+            queryCount = STRESS_PLAYERS;
+        }
+        else
+        {
+            players[0].position = GetMousePosition();
+            queryCount = 1;
+        }
+
+        queryHits = 0;
+        queryTested = 0;
+        double queryStartTime = GetTime();
+        for (int i = 0; i < queryCount; i++)
+        {
+            int tested = 0;
+            players[i].hit = (CheckCollisionBulletGrid(&bulletGrid, &bullets, players[i].position, PLAYER_HITBOX_RADIUS + (float)bulletRadius, &tested) > 0);
+            if (players[i].hit) queryHits++;
+            queryTested += tested;
+        }
+        queryTime = (GetTime() - queryStartTime)*1000.0;
+
+        if (!collisionStressMode && players[0].hit) playerHits++;
+
+        // Same query testing every bullet, the cost the grid avoids
+        if (collisionStressMode)
+        {
+            double bruteForceStartTime = GetTime();
+            float hitDistance = (PLAYER_HITBOX_RADIUS + bulletRadius)*(PLAYER_HITBOX_RADIUS + bulletRadius);
+            volatile int hits = 0;
+            for (int i = 0; i < bullets.count; i++)
+            {
+                float dx = bullets.positionX[i] - players[0].position.x;
+                float dy = bullets.positionY[i] - players[0].position.y;
+                if ((dx*dx + dy*dy) <= hitDistance) hits++;
             }
+            bruteForceTime = (GetTime() - bruteForceStartTime)*1000.0;
         }
 
         // Input logic
@@ -152,7 +430,21 @@ int main(void)
         if ((IsKeyPressed(KEY_DOWN) || IsKeyPressed(KEY_S)) && (bulletSpeed > 0.50f)) bulletSpeed -= 0.25f;
         if (IsKeyPressed(KEY_Z) && (spawnCooldown > 1)) spawnCooldown--;
         if (IsKeyPressed(KEY_X)) spawnCooldown++;
-        if (IsKeyPressed(KEY_ENTER)) drawInPerformanceMode = !drawInPerformanceMode;
+        if (IsKeyPressed(KEY_ENTER))
+        {
+            drawMode = (drawMode + 1)%DRAW_MODE_COUNT;
+            if ((drawMode == DRAW_MODE_INSTANCED) && !bulletRenderer.ready) drawMode = DRAW_MODE_CIRCLES;
+        }
+        if (IsKeyPressed(KEY_F))
+        {
+            frameLimit = !frameLimit;
+            SetTargetFPS(frameLimit? 60 : 0);
+        }
+        if (IsKeyPressed(KEY_V)) updateWithSIMD = !updateWithSIMD;
+        if (IsKeyPressed(KEY_T)) updateWithThreads = !updateWithThreads;
+        if (IsKeyPressed(KEY_Q) && (jobs.activeCount > 1)) jobs.activeCount--;
+        if (IsKeyPressed(KEY_E) && (jobs.activeCount < jobs.workerCount)) jobs.activeCount++;
+        if (IsKeyPressed(KEY_H)) collisionStressMode = !collisionStressMode;
 
         if (IsKeyDown(KEY_SPACE))
         {
@@ -162,8 +454,30 @@ int main(void)
 
         if (IsKeyPressed(KEY_C))
         {
-            bulletCount = 0;
-            bulletDisabledCount = 0;
+            bullets.count = 0;
+            playerHits = 0;
+        }
+
+        // Time both update kernels on the same full pool
+        if (IsKeyPressed(KEY_B))
+        {
+            benchmarkScalar = BenchmarkBulletsUpdate(UpdateBulletsScalar, bulletBounds, screenWidth, screenHeight);
+            benchmarkSIMD = BenchmarkBulletsUpdate(UpdateBulletsSIMD, bulletBounds, screenWidth, screenHeight);
+
+            TraceLog(LOG_INFO, "BULLETS: Update benchmark, scalar: %.0f bullets/ms, SIMD (%s): %.0f bullets/ms (x%.2f)",
+                benchmarkScalar, BULLET_SIMD_NAME, benchmarkSIMD, benchmarkSIMD/benchmarkScalar);
+
+            // Scaling of the multithreaded update, same kernel and bullets
+            int activeCount = jobs.activeCount;
+            bulletJobs.kernel = MoveBulletsSIMD;
+            for (int threads = 1; threads <= jobs.workerCount; threads = NextBenchmarkThreads(threads, jobs.workerCount))
+            {
+                jobs.activeCount = threads;
+                benchmarkThreads[threads] = BenchmarkBulletsUpdate(UpdateBulletsParallel, bulletBounds, screenWidth, screenHeight);
+                TraceLog(LOG_INFO, "BULLETS: Update benchmark, SIMD with %d threads: %.0f bullets/ms (x%.2f)",
+                    threads, benchmarkThreads[threads], benchmarkThreads[threads]/benchmarkThreads[1]);
+            }
+            jobs.activeCount = activeCount;
         }
         //----------------------------------------------------------------------------------
 
@@ -182,53 +496,141 @@ int main(void)
             DrawCircleLines(screenWidth/2, screenHeight/2, 50, BLACK);
             DrawCircleLines(screenWidth/2, screenHeight/2, 30, BLACK);
 
-            // Draw bullets
-            if (drawInPerformanceMode)
+            // Draw bullets, only live bullets are in the pool
+            // NOTE: Batched bullets are sent to the GPU before measuring, instanced bullets skip the batch
+            double drawStartTime = GetTime();
+            if (drawMode == DRAW_MODE_INSTANCED)
+            {
+                // Draw all bullets with one instanced draw call
+                DrawBulletsInstanced(&bulletRenderer, &bullets, bulletTexture.texture);
+            }
+            else if (drawMode == DRAW_MODE_TEXTURES)
             {
                 // Draw bullets using pre-rendered texture containing circle
-                for (int i = 0; i < bulletCount; i++)
+                for (int i = 0; i < bullets.count; i++)
                 {
-                    // Do not draw disabled bullets (out of screen)
-                    if (!bullets[i].disabled)
-                    {
-                        DrawTexture(bulletTexture.texture,
-                            (int)(bullets[i].position.x - bulletTexture.texture.width*0.5f),
-                            (int)(bullets[i].position.y - bulletTexture.texture.height*0.5f),
-                            bullets[i].color);
-                    }
+                    DrawTexture(bulletTexture.texture,
+                        (int)(bullets.positionX[i] - bulletTexture.texture.width*0.5f),
+                        (int)(bullets.positionY[i] - bulletTexture.texture.height*0.5f),
+                        bullets.color[i]);
                 }
-            } 
+            }
             else
             {
                 // Draw bullets using DrawCircle(), less performant
-                for (int i = 0; i < bulletCount; i++)
+                for (int i = 0; i < bullets.count; i++)
                 {
-                    // Do not draw disabled bullets (out of screen)
-                    if (!bullets[i].disabled)
-                    {
-                        DrawCircleV(bullets[i].position, (float)bulletRadius, bullets[i].color);
-                        DrawCircleLinesV(bullets[i].position, (float)bulletRadius, BLACK);
-                    }
+                    Vector2 position = { bullets.positionX[i], bullets.positionY[i] };
+                    DrawCircleV(position, (float)bulletRadius, bullets.color[i]);
+                    DrawCircleLinesV(position, (float)bulletRadius, BLACK);
                 }
             }
+            rlDrawRenderBatchActive();
+            drawTime[drawMode] += ((float)(GetTime() - drawStartTime)*1000.0f - drawTime[drawMode])*0.1f;
+            lastDrawMode = drawMode;
+
+            // Draw players, the hitbox turns red while a bullet overlaps it
+            if (collisionStressMode)
+            {
+                for (int i = 0; i < STRESS_PLAYERS; i++) DrawCircleV(players[i].position, PLAYER_HITBOX_RADIUS, players[i].hit? RED : DARKGREEN);
+            }
+            else
+            {
+                DrawCircleLinesV(players[0].position, 12, DARKGRAY);
+                DrawCircleV(players[0].position, PLAYER_HITBOX_RADIUS, players[0].hit? RED : DARKGREEN);
+            }
 
             // Draw UI
-            DrawRectangle(10, 10, 280, 150, (Color){0,0, 0, 200 });
+            DrawRectangle(10, 10, 280, 290, (Color){0,0, 0, 200 });
             DrawText("Controls:", 20, 20, 10, LIGHTGRAY);
             DrawText("- Right/Left or A/D: Change rows number", 40, 40, 10, LIGHTGRAY);
             DrawText("- Up/Down or W/S: Change bullet speed", 40, 60, 10, LIGHTGRAY);
             DrawText("- Z or X: Change spawn cooldown", 40, 80, 10, LIGHTGRAY);
             DrawText("- Space (Hold): Change the angle increment", 40, 100, 10, LIGHTGRAY);
-            DrawText("- Enter: Switch draw method (Performance)", 40, 120, 10, LIGHTGRAY);
-            DrawText("- C: Clear bullets", 40, 140, 10, LIGHTGRAY);
+            DrawText("- Enter: Switch draw method (Instanced)", 40, 120, 10, LIGHTGRAY);
+            DrawText("- V: Switch update method (SIMD)", 40, 140, 10, LIGHTGRAY);
+            DrawText("- T: Switch update threads (Multithreaded)", 40, 160, 10, LIGHTGRAY);
+            DrawText("- Q or E: Change update threads number", 40, 180, 10, LIGHTGRAY);
+            DrawText("- B: Benchmark update methods", 40, 200, 10, LIGHTGRAY);
+            DrawText("- C: Clear bullets", 40, 220, 10, LIGHTGRAY);
+            DrawText("- Mouse: Move player", 40, 240, 10, LIGHTGRAY);
+            DrawText("- H: Switch collision stress mode", 40, 260, 10, LIGHTGRAY);
+            DrawText("- F: Switch frame limit (60 FPS)", 40, 280, 10, LIGHTGRAY);
+
+            // Frame time of every draw method, last measured while the method was in use
+            const char *drawModeNames[DRAW_MODE_COUNT] = { "DrawCircle(*)", "DrawTexture(*)", "Instanced" };
+            DrawRectangle(10, 310, 280, 80, (Color){0,0, 0, 200 });
+            DrawText(TextFormat("Frame time (%s):", frameLimit? "60 FPS limit" : "no limit"), 20, 320, 10, LIGHTGRAY);
+            for (int mode = 0; mode < DRAW_MODE_COUNT; mode++)
+            {
+                DrawText(TextFormat("- %s: %.2f ms, bullets draw %.2f ms", drawModeNames[mode], frameTime[mode], drawTime[mode]),
+                    40, 340 + 15*mode, 10, (mode == drawMode)? GREEN : LIGHTGRAY);
+            }
+
+            DrawRectangle(580, 10, 200, 70, (Color){0,0, 0, 200 });
+            DrawText(TextFormat("Draw method: %s", drawModeNames[drawMode]), 590, 20, 10, (drawMode == DRAW_MODE_CIRCLES)? RED : GREEN);
+            if (updateWithSIMD) DrawText(TextFormat("Update method: SIMD (%s)", BULLET_SIMD_NAME), 590, 40, 10, GREEN);
+            else DrawText("Update method: scalar", 590, 40, 10, RED);
+            if (updateWithThreads) DrawText(TextFormat("Update threads: %i, %.2f ms", jobs.activeCount, updateTime), 590, 60, 10, GREEN);
+            else DrawText(TextFormat("Update threads: main only, %.2f ms", updateTime), 590, 60, 10, RED);
+
+            // Time spent by every worker in the last update, longest bar is the whole update
+            int barsY = 90;
+            if (updateWithThreads)
+            {
+                double longestTime = 0.0;
+                for (int i = 0; i < jobs.activeCount; i++) if (jobs.workers[i].busyTime > longestTime) longestTime = jobs.workers[i].busyTime;
+
+                // NOTE: With many workers only the bars are drawn, thinner
+                int rowHeight = (jobs.activeCount <= 12)? 14 : 5;
+                DrawRectangle(580, barsY, 200, 10 + rowHeight*jobs.activeCount, (Color){0,0, 0, 200 });
+                for (int i = 0; i < jobs.activeCount; i++)
+                {
+                    const JobWorker *worker = &jobs.workers[i];
+                    int barWidth = (longestTime > 0.0)? (int)(80*worker->busyTime/longestTime) : 0;
+
+                    DrawRectangle(590, barsY + 5 + rowHeight*i, barWidth, rowHeight - 4, (worker->jobsStolen > 0)? ORANGE : SKYBLUE);
+                    if (rowHeight == 14) DrawText(TextFormat("%.2f ms, %i jobs (%i stolen)", worker->busyTime, worker->jobsRun, worker->jobsStolen), 675, barsY + 5 + rowHeight*i, 10, LIGHTGRAY);
+                }
+                barsY += 20 + rowHeight*jobs.activeCount;
+            }
+
+            // Collision queries cost, the grid rebuild and the queries of this frame
+            DrawRectangle(580, barsY, 200, (collisionStressMode? 90 : 70), (Color){0,0, 0, 200 });
+            DrawText(TextFormat("Grid: %ix%i cells, %.2f ms", bulletGrid.columns, bulletGrid.rows, gridTime), 590, barsY + 10, 10, LIGHTGRAY);
+            DrawText(TextFormat("Queries: %i, %.3f ms (%.2f us each)", queryCount, queryTime, (queryCount > 0)? queryTime*1000.0/queryCount : 0.0), 590, barsY + 30, 10, GREEN);
+            if (collisionStressMode)
+            {
+                DrawText(TextFormat("Tested: %.1f bullets/query, %i hit", (queryCount > 0)? (float)queryTested/queryCount : 0.0f, queryHits), 590, barsY + 50, 10, LIGHTGRAY);
+                DrawText(TextFormat("All bullets query: %.3f ms", bruteForceTime), 590, barsY + 70, 10, RED);
+                barsY += 100;
+            }
+            else
+            {
+                DrawText(TextFormat("Tested: %i bullets, player hits: %i", queryTested, playerHits), 590, barsY + 50, 10, LIGHTGRAY);
+                barsY += 80;
+            }
 
-            DrawRectangle(610, 10, 170, 30, (Color){0,0, 0, 200 });
-            if (drawInPerformanceMode) DrawText("Draw method: DrawTexture(*)", 620, 20, 10, GREEN);
-            else DrawText("Draw method: DrawCircle(*)", 620, 20, 10, RED);
+            if (benchmarkScalar > 0.0f)
+            {
+                int benchmarkRows = 0;
+                for (int threads = 1; threads <= jobs.workerCount; threads = NextBenchmarkThreads(threads, jobs.workerCount)) benchmarkRows++;
+
+                int lineY = barsY + 50;
+                DrawRectangle(580, barsY, 200, 50 + 20*benchmarkRows, (Color){0,0, 0, 200 });
+                DrawText(TextFormat("Scalar: %.0f bullets/ms", benchmarkScalar), 590, barsY + 10, 10, LIGHTGRAY);
+                DrawText(TextFormat("SIMD (%s): %.0f bullets/ms (x%.2f)", BULLET_SIMD_NAME, benchmarkSIMD, benchmarkSIMD/benchmarkScalar), 590, barsY + 30, 10, GREEN);
+                for (int threads = 1; threads <= jobs.workerCount; threads = NextBenchmarkThreads(threads, jobs.workerCount))
+                {
+                    DrawText(TextFormat("%i threads: %.0f bullets/ms (x%.2f)", threads, benchmarkThreads[threads], benchmarkThreads[threads]/benchmarkThreads[1]),
+                        590, lineY, 10, SKYBLUE);
+                    lineY += 20;
+                }
+            }
 
             DrawRectangle(135, 410, 530, 30, (Color){0,0, 0, 200 });
             DrawText(TextFormat("[ FPS: %d, Bullets: %d, Rows: %d, Bullet speed: %.2f, Angle increment per frame: %d, Cooldown: %.0f ]",
-                    GetFPS(), bulletCount - bulletDisabledCount, bulletRows, bulletSpeed,  angleIncrement, spawnCooldown),
+                    GetFPS(), bullets.count, bulletRows, bulletSpeed,  angleIncrement, spawnCooldown),
                 155, 420, 10, GREEN);
 
         EndDrawing();
@@ -238,11 +640,697 @@ int main(void)
     // De-Initialization
     //--------------------------------------------------------------------------------------
     UnloadRenderTexture(bulletTexture); // Unload bullet texture
+    UnloadBulletRenderer(&bulletRenderer);  // Unload instancing shader and buffers
 
-    RL_FREE(bullets);     // Free bullets array data
+    StopJobSystem();              // Stop worker threads
+
+    UnloadBulletPool(&bullets);   // Free bullets arrays data
+    UnloadBulletGrid(&bulletGrid);
+    RL_FREE(players);
+    UnloadBulletPool(&bulletJobs.output);
+    RL_FREE(bulletJobs.chunkLive);
+    RL_FREE(bulletJobs.chunkOffset);
 
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
     return 0;
-}
\ No newline at end of file
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Allocate a bullets pool, all arrays have room for a last partial SIMD batch
+static BulletPool LoadBulletPool(int capacity)
+{
+    BulletPool pool = { 0 };
+    int size = capacity + BULLET_SIMD_WIDTH;
+
+    pool.positionX = (float *)RL_CALLOC(size, sizeof(float));
+    pool.positionY = (float *)RL_CALLOC(size, sizeof(float));
+    pool.accelerationX = (float *)RL_CALLOC(size, sizeof(float));
+    pool.accelerationY = (float *)RL_CALLOC(size, sizeof(float));
+    pool.color = (Color *)RL_CALLOC(size, sizeof(Color));
+    pool.capacity = capacity;
+
+    return pool;
+}
+
+// Free a bullets pool
+static void UnloadBulletPool(BulletPool *pool)
+{
+    RL_FREE(pool->positionX);
+    RL_FREE(pool->positionY);
+    RL_FREE(pool->accelerationX);
+    RL_FREE(pool->accelerationY);
+    RL_FREE(pool->color);
+
+    *pool = (BulletPool){ 0 };
+}
+
+// Add a bullet at the end of the live bullets, ignored if the pool is full
+static void SpawnBullet(BulletPool *pool, Vector2 position, Vector2 acceleration, Color color)
+{
+    if (pool->count >= pool->capacity) return;
+
+    int i = pool->count;
+    pool->positionX[i] = position.x;
+    pool->positionY[i] = position.y;
+    pool->accelerationX[i] = acceleration.x;
+    pool->accelerationY[i] = acceleration.y;
+    pool->color[i] = color;
+    pool->count++;
+}
+
+// Move bullets [start, start + count) of input and write the ones still in bounds to output from offset, one bullet at a time
+// NOTE: Live bullets are written in order with no gaps (stream compaction), so the pool stays dense and the next
+// update and the drawing never visit dead bullets. Input and output can be the same pool when offset <= start,
+// every bullet is read before its slot can be overwritten
+// Returns the number of bullets written
+static int MoveBulletsScalar(const BulletPool *input, int start, int count, BulletPool *output, int offset, Rectangle bounds)
+{
+    const float minX = bounds.x, maxX = bounds.x + bounds.width;
+    const float minY = bounds.y, maxY = bounds.y + bounds.height;
+    int live = offset;
+
+    for (int i = start; i < start + count; i++)
+    {
+        float x = input->positionX[i] + input->accelerationX[i];
+        float y = input->positionY[i] + input->accelerationY[i];
+
+        if ((x >= minX) && (x <= maxX) && (y >= minY) && (y <= maxY))
+        {
+            output->positionX[live] = x;
+            output->positionY[live] = y;
+            output->accelerationX[live] = input->accelerationX[i];
+            output->accelerationY[live] = input->accelerationY[i];
+            output->color[live] = input->color[i];
+            live++;
+        }
+    }
+
+    return live - offset;
+}
+
+// Move bullets [start, start + count) of input and write the ones still in bounds to output from offset, BULLET_SIMD_WIDTH bullets at a time
+// NOTE: Same results as MoveBulletsScalar(), batches with all bullets alive are written with vector
+// stores, only batches with a removed bullet are compacted one bullet at a time
+// Returns the number of bullets written
+static int MoveBulletsSIMD(const BulletPool *input, int start, int count, BulletPool *output, int offset, Rectangle bounds)
+{
+#if (BULLET_SIMD_WIDTH > 1)
+    const SIMD_FLOAT minX = SIMD_SET(bounds.x), maxX = SIMD_SET(bounds.x + bounds.width);
+    const SIMD_FLOAT minY = SIMD_SET(bounds.y), maxY = SIMD_SET(bounds.y + bounds.height);
+    const int allInside = (1 << BULLET_SIMD_WIDTH) - 1;
+    int end = start + count;
+    int live = offset;
+    int i = start;
+
+    for (; i + BULLET_SIMD_WIDTH <= end; i += BULLET_SIMD_WIDTH)
+    {
+        SIMD_FLOAT accelerationX = SIMD_LOAD(input->accelerationX + i);
+        SIMD_FLOAT accelerationY = SIMD_LOAD(input->accelerationY + i);
+        SIMD_FLOAT x = SIMD_ADD(SIMD_LOAD(input->positionX + i), accelerationX);
+        SIMD_FLOAT y = SIMD_ADD(SIMD_LOAD(input->positionY + i), accelerationY);
+
+        SIMD_FLOAT inside = SIMD_AND(SIMD_AND(SIMD_GE(x, minX), SIMD_LE(x, maxX)), SIMD_AND(SIMD_GE(y, minY), SIMD_LE(y, maxY)));
+        int mask = SIMD_MASK(inside);
+
+        if (mask == allInside)
+        {
+            // NOTE: In place, live <= i, stores only overwrite bullets already loaded
+            SIMD_INT colors = SIMD_LOAD_INT(input->color + i);
+            SIMD_STORE(output->positionX + live, x);
+            SIMD_STORE(output->positionY + live, y);
+            SIMD_STORE(output->accelerationX + live, accelerationX);
+            SIMD_STORE(output->accelerationY + live, accelerationY);
+            SIMD_STORE_INT(output->color + live, colors);
+            live += BULLET_SIMD_WIDTH;
+        }
+        else if (mask != 0)
+        {
+            float movedX[BULLET_SIMD_WIDTH], movedY[BULLET_SIMD_WIDTH];
+            SIMD_STORE(movedX, x);
+            SIMD_STORE(movedY, y);
+
+            for (int lane = 0; lane < BULLET_SIMD_WIDTH; lane++)
+            {
+                if (mask & (1 << lane))
+                {
+                    output->positionX[live] = movedX[lane];
+                    output->positionY[live] = movedY[lane];
+                    output->accelerationX[live] = input->accelerationX[i + lane];
+                    output->accelerationY[live] = input->accelerationY[i + lane];
+                    output->color[live] = input->color[i + lane];
+                    live++;
+                }
+            }
+        }
+    }
+
+    // Last partial batch
+    return (live - offset) + MoveBulletsScalar(input, i, end - i, output, live, bounds);
+#else
+    return MoveBulletsScalar(input, start, count, output, offset, bounds);
+#endif
+}
+
+// Move every bullet of the pool and remove the ones out of bounds, with the scalar kernel
+// Returns the number of bullets removed
+static int UpdateBulletsScalar(BulletPool *pool, Rectangle bounds)
+{
+    int count = pool->count;
+    pool->count = MoveBulletsScalar(pool, 0, count, pool, 0, bounds);
+
+    return count - pool->count;
+}
+
+// Move every bullet of the pool and remove the ones out of bounds, with the SIMD kernel
+// Returns the number of bullets removed
+static int UpdateBulletsSIMD(BulletPool *pool, Rectangle bounds)
+{
+    int count = pool->count;
+    pool->count = MoveBulletsSIMD(pool, 0, count, pool, 0, bounds);
+
+    return count - pool->count;
+}
+
+// Time an update kernel on a full pool of bullets spread over the screen, returns bullets updated per millisecond
+// NOTE: Every kernel gets the same bullets, a few of them leave the screen and are compacted every update
+static float BenchmarkBulletsUpdate(int (*update)(BulletPool *, Rectangle), Rectangle bounds, int screenWidth, int screenHeight)
+{
+    BulletPool pool = LoadBulletPool(BENCHMARK_BULLETS);
+
+    SetRandomSeed(BENCHMARK_BULLETS);
+    for (int i = 0; i < BENCHMARK_BULLETS; i++)
+    {
+        Vector2 position = { (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(0, screenHeight) };
+        Vector2 acceleration = { GetRandomValue(-300, 300)/100.0f, GetRandomValue(-300, 300)/100.0f };
+        SpawnBullet(&pool, position, acceleration, (i%2 == 0)? RED : BLUE);
+    }
+
+    long long updated = 0;
+    double startTime = GetTime();
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++)
+    {
+        updated += pool.count;
+        update(&pool, bounds);
+    }
+    double elapsed = (GetTime() - startTime)*1000.0;
+
+    UnloadBulletPool(&pool);
+
+    return (elapsed > 0.0)? (float)(updated/elapsed) : 0.0f;
+}
+
+// Load the instancing shader and the instance buffers for capacity bullets
+// NOTE: Instancing is not available if the shader does not load, check renderer.ready
+static BulletRenderer LoadBulletRenderer(int capacity)
+{
+    BulletRenderer renderer = { 0 };
+
+    renderer.shader = LoadShader(TextFormat("resources/shaders/glsl%i/bullet_instanced.vs", GLSL_VERSION),
+                                 TextFormat("resources/shaders/glsl%i/bullet_instanced.fs", GLSL_VERSION));
+    renderer.mvpLoc = GetShaderLocation(renderer.shader, "mvp");
+    renderer.textureLoc = GetShaderLocation(renderer.shader, "texture0");
+    renderer.sizeLoc = GetShaderLocation(renderer.shader, "bulletSize");
+    renderer.capacity = capacity;
+
+    int vertexLoc = GetShaderLocationAttrib(renderer.shader, "vertexPosition");
+    int positionXLoc = GetShaderLocationAttrib(renderer.shader, "instancePositionX");
+    int positionYLoc = GetShaderLocationAttrib(renderer.shader, "instancePositionY");
+    int colorLoc = GetShaderLocationAttrib(renderer.shader, "instanceColor");
+
+    if ((renderer.shader.id == rlGetShaderIdDefault()) || (vertexLoc < 0) || (positionXLoc < 0) || (positionYLoc < 0) || (colorLoc < 0))
+    {
+        TraceLog(LOG_WARNING, "BULLETS: Instanced drawing not available");
+        return renderer;
+    }
+
+    // Quad corners, two triangles
+    const float quad[12] = { 0.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f };
+    renderer.quadVboId = rlLoadVertexBuffer(quad, sizeof(quad), false);
+
+    for (int i = 0; i < BULLET_INSTANCE_BUFFERS; i++)
+    {
+        renderer.vaoId[i] = rlLoadVertexArray();
+        rlEnableVertexArray(renderer.vaoId[i]);
+
+        rlEnableVertexBuffer(renderer.quadVboId);
+        rlSetVertexAttribute(vertexLoc, 2, RL_FLOAT, false, 0, 0);
+        rlEnableVertexAttribute(vertexLoc);
+
+        // Instance attributes advance once per bullet
+        renderer.positionXVboId[i] = rlLoadVertexBuffer(NULL, capacity*sizeof(float), true);
+        rlSetVertexAttribute(positionXLoc, 1, RL_FLOAT, false, 0, 0);
+        rlSetVertexAttributeDivisor(positionXLoc, 1);
+        rlEnableVertexAttribute(positionXLoc);
+
+        renderer.positionYVboId[i] = rlLoadVertexBuffer(NULL, capacity*sizeof(float), true);
+        rlSetVertexAttribute(positionYLoc, 1, RL_FLOAT, false, 0, 0);
+        rlSetVertexAttributeDivisor(positionYLoc, 1);
+        rlEnableVertexAttribute(positionYLoc);
+
+        renderer.colorVboId[i] = rlLoadVertexBuffer(NULL, capacity*sizeof(Color), true);
+        rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, true, 0, 0);
+        rlSetVertexAttributeDivisor(colorLoc, 1);
+        rlEnableVertexAttribute(colorLoc);
+
+        rlDisableVertexArray();
+    }
+
+    rlDisableVertexBuffer();
+    renderer.ready = true;
+
+    return renderer;
+}
+
+// Unload the instancing shader and buffers
+static void UnloadBulletRenderer(BulletRenderer *renderer)
+{
+    if (renderer->ready)
+    {
+        for (int i = 0; i < BULLET_INSTANCE_BUFFERS; i++)
+        {
+            rlUnloadVertexArray(renderer->vaoId[i]);
+            rlUnloadVertexBuffer(renderer->positionXVboId[i]);
+            rlUnloadVertexBuffer(renderer->positionYVboId[i]);
+            rlUnloadVertexBuffer(renderer->colorVboId[i]);
+        }
+        rlUnloadVertexBuffer(renderer->quadVboId);
+    }
+
+    UnloadShader(renderer->shader);
+
+    *renderer = (BulletRenderer){ 0 };
+}
+
+// Draw all the pool bullets with one instanced draw call, same size and placement as DrawTexture()
+static void DrawBulletsInstanced(BulletRenderer *renderer, const BulletPool *pool, Texture2D texture)
+{
+    int count = (pool->count < renderer->capacity)? pool->count : renderer->capacity;
+    if (!renderer->ready || (count == 0)) return;
+
+    // Batched shapes go first, drawing order is kept
+    rlDrawRenderBatchActive();
+
+    // Upload the live bullets to the next buffers set, the previous sets can still be in use by the GPU
+    int set = renderer->current;
+    renderer->current = (renderer->current + 1)%BULLET_INSTANCE_BUFFERS;
+    rlUpdateVertexBuffer(renderer->positionXVboId[set], pool->positionX, count*sizeof(float), 0);
+    rlUpdateVertexBuffer(renderer->positionYVboId[set], pool->positionY, count*sizeof(float), 0);
+    rlUpdateVertexBuffer(renderer->colorVboId[set], pool->color, count*sizeof(Color), 0);
+
+    Matrix mvp = MatrixMultiply(rlGetMatrixModelview(), rlGetMatrixProjection());
+    float size = (float)texture.width;
+    int textureSlot = 0;
+
+    rlEnableShader(renderer->shader.id);
+    rlSetUniformMatrix(renderer->mvpLoc, mvp);
+    rlSetUniform(renderer->sizeLoc, &size, SHADER_UNIFORM_FLOAT, 1);
+    rlSetUniform(renderer->textureLoc, &textureSlot, SHADER_UNIFORM_INT, 1);
+
+    rlActiveTextureSlot(textureSlot);
+    rlEnableTexture(texture.id);
+
+    rlEnableVertexArray(renderer->vaoId[set]);
+    rlDrawVertexArrayInstanced(0, 6, count);
+    rlDisableVertexArray();
+
+    rlDisableTexture();
+    rlDisableShader();
+}
+
+// Allocate a collision grid covering bounds, with room for capacity bullets
+static BulletGrid LoadBulletGrid(Rectangle bounds, float cellSize, int capacity)
+{
+    BulletGrid grid = { 0 };
+
+    grid.bounds = bounds;
+    grid.cellSize = cellSize;
+    grid.columns = (int)ceilf(bounds.width/cellSize);
+    grid.rows = (int)ceilf(bounds.height/cellSize);
+    grid.cellStart = (int *)RL_CALLOC(grid.columns*grid.rows + 1, sizeof(int));
+    grid.bulletIndex = (int *)RL_CALLOC(capacity, sizeof(int));
+    grid.bulletCell = (int *)RL_CALLOC(capacity, sizeof(int));
+    grid.capacity = capacity;
+
+    return grid;
+}
+
+// Free a collision grid
+static void UnloadBulletGrid(BulletGrid *grid)
+{
+    RL_FREE(grid->cellStart);
+    RL_FREE(grid->bulletIndex);
+    RL_FREE(grid->bulletCell);
+
+    *grid = (BulletGrid){ 0 };
+}
+
+// Cell containing a point, points out of the grid are clamped to the border cells
+static inline int GetBulletGridCell(const BulletGrid *grid, float x, float y)
+{
+    int column = (int)((x - grid->bounds.x)/grid->cellSize);
+    int row = (int)((y - grid->bounds.y)/grid->cellSize);
+
+    if (column < 0) column = 0;
+    else if (column >= grid->columns) column = grid->columns - 1;
+    if (row < 0) row = 0;
+    else if (row >= grid->rows) row = grid->rows - 1;
+
+    return row*grid->columns + column;
+}
+
+// Sort the pool bullets by cell, counting sort in two passes over the bullets
+// NOTE: Bullets of a cell keep the pool order
+static void UpdateBulletGrid(BulletGrid *grid, const BulletPool *pool)
+{
+    int cellCount = grid->columns*grid->rows;
+    int count = (pool->count < grid->capacity)? pool->count : grid->capacity;
+
+    // Count the bullets of every cell
+    memset(grid->cellStart, 0, (cellCount + 1)*sizeof(int));
+    for (int i = 0; i < count; i++)
+    {
+        int cell = GetBulletGridCell(grid, pool->positionX[i], pool->positionY[i]);
+        grid->bulletCell[i] = cell;
+        grid->cellStart[cell + 1]++;
+    }
+
+    // Prefix sum, first sorted bullet of every cell
+    for (int cell = 0; cell < cellCount; cell++) grid->cellStart[cell + 1] += grid->cellStart[cell];
+
+    // Place the bullets, cellStart is used as the insert position and shifted back one cell after
+    for (int i = 0; i < count; i++) grid->bulletIndex[grid->cellStart[grid->bulletCell[i]]++] = i;
+    for (int cell = cellCount; cell > 0; cell--) grid->cellStart[cell] = grid->cellStart[cell - 1];
+    grid->cellStart[0] = 0;
+}
+
+// Count the bullets with their center in a circle, only the bullets of the cells touched by the circle are tested
+// NOTE: Use the hitbox radius plus the bullet radius to check the hitbox against the bullet circles
+static int CheckCollisionBulletGrid(const BulletGrid *grid, const BulletPool *pool, Vector2 center, float radius, int *tested)
+{
+    int firstColumn = (int)floorf((center.x - radius - grid->bounds.x)/grid->cellSize);
+    int lastColumn = (int)floorf((center.x + radius - grid->bounds.x)/grid->cellSize);
+    int firstRow = (int)floorf((center.y - radius - grid->bounds.y)/grid->cellSize);
+    int lastRow = (int)floorf((center.y + radius - grid->bounds.y)/grid->cellSize);
+
+    // Border cells also contain the bullets out of the grid
+    firstColumn = (firstColumn < 0)? 0 : ((firstColumn >= grid->columns)? grid->columns - 1 : firstColumn);
+    lastColumn = (lastColumn < 0)? 0 : ((lastColumn >= grid->columns)? grid->columns - 1 : lastColumn);
+    firstRow = (firstRow < 0)? 0 : ((firstRow >= grid->rows)? grid->rows - 1 : firstRow);
+    lastRow = (lastRow < 0)? 0 : ((lastRow >= grid->rows)? grid->rows - 1 : lastRow);
+
+    float radiusSqr = radius*radius;
+    int hits = 0;
+    int candidates = 0;
+
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        // Cells of a row are consecutive, their bullets too
+        int first = grid->cellStart[row*grid->columns + firstColumn];
+        int last = grid->cellStart[row*grid->columns + lastColumn + 1];
+        candidates += last - first;
+
+        for (int k = first; k < last; k++)
+        {
+            int i = grid->bulletIndex[k];
+            float dx = pool->positionX[i] - center.x;
+            float dy = pool->positionY[i] - center.y;
+            if ((dx*dx + dy*dy) <= radiusSqr) hits++;
+        }
+    }
+
+    if (tested != NULL) *tested = candidates;
+
+    return hits;
+}
+
+// Thread counts measured by the benchmark: powers of two, then all the workers
+static int NextBenchmarkThreads(int threads, int workerCount)
+{
+    if ((threads < workerCount) && (threads*2 > workerCount)) return workerCount;
+    return threads*2;
+}
+
+// Take the next job from the front of the worker own range, returns -1 once the range is empty
+static int TakeJob(JobWorker *worker)
+{
+    unsigned long long range = atomic_load(&worker->range);
+
+    while (true)
+    {
+        unsigned int first = (unsigned int)(range & 0xffffffff);
+        unsigned int end = (unsigned int)(range >> 32);
+        if (first >= end) return -1;
+
+        // On failure range is reloaded, a thief stole from the back
+        if (atomic_compare_exchange_weak(&worker->range, &range, range + 1)) return (int)first;
+    }
+}
+
+// Steal a job from the back of another worker range, returns -1 once the range is empty
+static int StealJob(JobWorker *victim)
+{
+    unsigned long long range = atomic_load(&victim->range);
+
+    while (true)
+    {
+        unsigned int first = (unsigned int)(range & 0xffffffff);
+        unsigned int end = (unsigned int)(range >> 32);
+        if (first >= end) return -1;
+
+        unsigned long long stolen = ((unsigned long long)(end - 1) << 32) | first;
+        if (atomic_compare_exchange_weak(&victim->range, &range, stolen)) return (int)(end - 1);
+    }
+}
+
+// Run the jobs of the worker range, then steal from the other active workers until all ranges are empty
+// NOTE: Ranges only shrink during a batch, so one pass over the other workers finds all remaining jobs
+static void RunWorkerJobs(JobWorker *worker)
+{
+    double startTime = GetTime();
+    int job = 0;
+
+    while ((job = TakeJob(worker)) >= 0)
+    {
+        jobs.func(jobs.data, job);
+        worker->jobsRun++;
+    }
+
+    for (int i = 1; i < jobs.activeCount; i++)
+    {
+        JobWorker *victim = &jobs.workers[(worker->index + i)%jobs.activeCount];
+
+        while ((job = StealJob(victim)) >= 0)
+        {
+            jobs.func(jobs.data, job);
+            worker->jobsRun++;
+            worker->jobsStolen++;
+        }
+    }
+
+    worker->busyTime += (GetTime() - startTime)*1000.0;
+}
+
+// Worker thread, runs its part of every batch
+static void *JobWorkerThread(void *arg)
+{
+    JobWorker *worker = (JobWorker *)arg;
+    unsigned int lastBatch = 0;
+
+    pthread_mutex_lock(&jobs.mutex);
+    while (true)
+    {
+        while (!jobs.quit && (jobs.batch == lastBatch)) pthread_cond_wait(&jobs.batchStarted, &jobs.mutex);
+        if (jobs.quit) break;
+
+        lastBatch = jobs.batch;
+        bool active = (worker->index < jobs.activeCount);
+        pthread_mutex_unlock(&jobs.mutex);
+
+        if (active) RunWorkerJobs(worker);
+
+        pthread_mutex_lock(&jobs.mutex);
+        if (active)
+        {
+            jobs.pending--;
+            if (jobs.pending == 0) pthread_cond_signal(&jobs.batchDone);
+        }
+    }
+    pthread_mutex_unlock(&jobs.mutex);
+
+    return NULL;
+}
+
+// Start the job system worker threads, the calling thread is worker 0
+static void StartJobSystem(int workerCount)
+{
+    if (workerCount < 1) workerCount = 1;
+
+    pthread_mutex_init(&jobs.mutex, NULL);
+    pthread_cond_init(&jobs.batchStarted, NULL);
+    pthread_cond_init(&jobs.batchDone, NULL);
+
+    jobs.workerCount = 1;
+    jobs.workers[0].index = 0;
+    for (int i = 1; i < workerCount; i++)
+    {
+        jobs.workers[i].index = i;
+        if (pthread_create(&jobs.workers[i].thread, NULL, JobWorkerThread, &jobs.workers[i]) != 0) break;
+        jobs.workerCount++;
+    }
+    jobs.activeCount = jobs.workerCount;
+
+    TraceLog(LOG_INFO, "BULLETS: Job system started with %i workers", jobs.workerCount);
+}
+
+// Stop and join the job system worker threads
+static void StopJobSystem(void)
+{
+    pthread_mutex_lock(&jobs.mutex);
+    jobs.quit = true;
+    pthread_cond_broadcast(&jobs.batchStarted);
+    pthread_mutex_unlock(&jobs.mutex);
+
+    for (int i = 1; i < jobs.workerCount; i++) pthread_join(jobs.workers[i].thread, NULL);
+
+    pthread_mutex_destroy(&jobs.mutex);
+    pthread_cond_destroy(&jobs.batchStarted);
+    pthread_cond_destroy(&jobs.batchDone);
+}
+
+// Run jobs [0, jobCount) on the active workers and wait for all of them
+// NOTE: Every active worker starts with an even contiguous range of jobs, workers that finish early steal the rest
+static void RunJobs(JobFunc func, void *data, int jobCount)
+{
+    for (int i = 0; i < jobs.activeCount; i++)
+    {
+        unsigned long long first = (unsigned long long)jobCount*i/jobs.activeCount;
+        unsigned long long end = (unsigned long long)jobCount*(i + 1)/jobs.activeCount;
+        atomic_store(&jobs.workers[i].range, (end << 32) | first);
+    }
+
+    pthread_mutex_lock(&jobs.mutex);
+    jobs.func = func;
+    jobs.data = data;
+    jobs.pending = jobs.activeCount - 1;
+    jobs.batch++;
+    pthread_cond_broadcast(&jobs.batchStarted);
+    pthread_mutex_unlock(&jobs.mutex);
+
+    RunWorkerJobs(&jobs.workers[0]);
+
+    pthread_mutex_lock(&jobs.mutex);
+    while (jobs.pending > 0) pthread_cond_wait(&jobs.batchDone, &jobs.mutex);
+    pthread_mutex_unlock(&jobs.mutex);
+}
+
+// Count the bullets of [start, start + count) still in bounds after their next move, without moving them
+static int CountBulletsInBounds(const BulletPool *pool, int start, int count, Rectangle bounds)
+{
+    const float minX = bounds.x, maxX = bounds.x + bounds.width;
+    const float minY = bounds.y, maxY = bounds.y + bounds.height;
+    int end = start + count;
+    int live = 0;
+    int i = start;
+
+#if (BULLET_SIMD_WIDTH > 1)
+    const SIMD_FLOAT minX4 = SIMD_SET(minX), maxX4 = SIMD_SET(maxX);
+    const SIMD_FLOAT minY4 = SIMD_SET(minY), maxY4 = SIMD_SET(maxY);
+
+    for (; i + BULLET_SIMD_WIDTH <= end; i += BULLET_SIMD_WIDTH)
+    {
+        SIMD_FLOAT x = SIMD_ADD(SIMD_LOAD(pool->positionX + i), SIMD_LOAD(pool->accelerationX + i));
+        SIMD_FLOAT y = SIMD_ADD(SIMD_LOAD(pool->positionY + i), SIMD_LOAD(pool->accelerationY + i));
+        int mask = SIMD_MASK(SIMD_AND(SIMD_AND(SIMD_GE(x, minX4), SIMD_LE(x, maxX4)), SIMD_AND(SIMD_GE(y, minY4), SIMD_LE(y, maxY4))));
+
+        for (; mask != 0; mask &= mask - 1) live++;
+    }
+#endif
+
+    for (; i < end; i++)
+    {
+        float x = pool->positionX[i] + pool->accelerationX[i];
+        float y = pool->positionY[i] + pool->accelerationY[i];
+        if ((x >= minX) && (x <= maxX) && (y >= minY) && (y <= maxY)) live++;
+    }
+
+    return live;
+}
+
+// Count the live bullets of one chunk after the move
+static void CountBulletChunk(void *data, int chunk)
+{
+    BulletJobs *update = (BulletJobs *)data;
+    int start = chunk*BULLET_CHUNK_SIZE;
+    int count = (update->pool->count - start < BULLET_CHUNK_SIZE)? update->pool->count - start : BULLET_CHUNK_SIZE;
+
+    update->chunkLive[chunk] = CountBulletsInBounds(update->pool, start, count, update->bounds);
+}
+
+// Move one chunk of the pool to its position in the output pool
+static void MoveBulletChunk(void *data, int chunk)
+{
+    BulletJobs *update = (BulletJobs *)data;
+    int start = chunk*BULLET_CHUNK_SIZE;
+    int count = (update->pool->count - start < BULLET_CHUNK_SIZE)? update->pool->count - start : BULLET_CHUNK_SIZE;
+
+    update->kernel(update->pool, start, count, &update->output, update->chunkOffset[chunk], update->bounds);
+}
+
+// Move every bullet and remove the ones out of bounds, with the bullet chunks spread across the job system workers
+// NOTE: Chunks are written in order at the prefix sum of the live counts, so the result is the same,
+// bit for bit, as the single-threaded update
+// Returns the number of bullets removed
+static int UpdateBulletsParallel(BulletPool *pool, Rectangle bounds)
+{
+    BulletJobs *update = &bulletJobs;
+    if (update->kernel == NULL) update->kernel = MoveBulletsSIMD;
+
+    // Output pool and chunks data follow the pool capacity
+    if (update->output.capacity != pool->capacity)
+    {
+        UnloadBulletPool(&update->output);
+        RL_FREE(update->chunkLive);
+        RL_FREE(update->chunkOffset);
+
+        int maxChunks = (pool->capacity + BULLET_CHUNK_SIZE - 1)/BULLET_CHUNK_SIZE;
+        update->output = LoadBulletPool(pool->capacity);
+        update->chunkLive = (int *)RL_CALLOC(maxChunks, sizeof(int));
+        update->chunkOffset = (int *)RL_CALLOC(maxChunks, sizeof(int));
+    }
+
+    for (int i = 0; i < jobs.activeCount; i++)
+    {
+        jobs.workers[i].busyTime = 0.0;
+        jobs.workers[i].jobsRun = 0;
+        jobs.workers[i].jobsStolen = 0;
+    }
+
+    int count = pool->count;
+    update->pool = pool;
+    update->bounds = bounds;
+    update->chunkCount = (count + BULLET_CHUNK_SIZE - 1)/BULLET_CHUNK_SIZE;
+    RunJobs(CountBulletChunk, update, update->chunkCount);
+
+    // Prefix sum of the live bullets, the position of every chunk in the output
+    int live = 0;
+    for (int chunk = 0; chunk < update->chunkCount; chunk++)
+    {
+        update->chunkOffset[chunk] = live;
+        live += update->chunkLive[chunk];
+    }
+
+    RunJobs(MoveBulletChunk, update, update->chunkCount);
+
+    // The output becomes the pool, the previous pool arrays are the next update target
+    BulletPool previous = *pool;
+    *pool = update->output;
+    pool->count = live;
+    update->output = previous;
+    update->output.count = 0;
+
+    return count - live;
+}
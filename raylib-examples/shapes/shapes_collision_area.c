@@ -15,6 +15,57 @@
 
 #include "raylib.h"
 
+#include <stdlib.h>         // Required for: qsort()
+
+#define STRESS_BOXES    50000       // Moving boxes on stress mode
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Sweep and prune endpoint, start or end of a box on the x axis
+typedef struct SweepEndpoint {
+    float value;            // Box x start or end position
+    int box;                // Box index
+    bool min;               // Endpoint is the box start, otherwise its end
+    int tieOrder;           // Order between endpoints at the same position
+} SweepEndpoint;
+
+// Pair of overlapping boxes
+typedef struct CollisionPair {
+    int a;
+    int b;
+} CollisionPair;
+
+// Sweep and prune broadphase
+// NOTE: Endpoints stay sorted from one frame to the next, boxes only move a little between frames
+// so the insertion sort of the endpoints is close to linear
+typedef struct SweepAndPrune {
+    SweepEndpoint *endpoints;   // Boxes start and end on the x axis, sorted
+    int boxCount;
+
+    // Boxes crossing the current sweep position
+    int *activeBoxes;
+    float *activeMinY;
+    float *activeMaxY;
+    int *activePositions;       // Position of every box on the active list
+
+    CollisionPair *pairs;       // Overlapping boxes found by the last update
+    int pairCount;
+    int pairCapacity;
+
+    int swaps;                  // Endpoints moved by the last sort
+} SweepAndPrune;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+// Init sweep and prune broadphase for the provided boxes
+static SweepAndPrune InitSweepAndPrune(const Rectangle *boxes, int boxCount);
+// Update sweep and prune broadphase with the boxes new positions, returns overlapping pairs found
+static int UpdateSweepAndPrune(SweepAndPrune *sap, const Rectangle *boxes);
+// Unload sweep and prune broadphase
+static void UnloadSweepAndPrune(SweepAndPrune *sap);
+
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -41,6 +92,22 @@ int main(void)
     bool pause = false;             // Movement pause
     bool collision = false;         // Collision detection
 
+    // Stress mode: many moving boxes, overlaps found with a sweep and prune broadphase
+    Rectangle *boxes = (Rectangle *)RL_CALLOC(STRESS_BOXES, sizeof(Rectangle));
+    Vector2 *boxSpeeds = (Vector2 *)RL_CALLOC(STRESS_BOXES, sizeof(Vector2));
+    bool *boxColliding = (bool *)RL_CALLOC(STRESS_BOXES, sizeof(bool));
+
+    for (int i = 0; i < STRESS_BOXES; i++)
+    {
+        float size = (float)GetRandomValue(1, 3);
+        boxes[i] = (Rectangle){ (float)GetRandomValue(0, screenWidth - (int)size), (float)GetRandomValue(screenUpperLimit, screenHeight - (int)size), size, size };
+        boxSpeeds[i] = (Vector2){ GetRandomValue(-50, 50)/100.0f, GetRandomValue(-50, 50)/100.0f };
+    }
+
+    SweepAndPrune sap = InitSweepAndPrune(boxes, STRESS_BOXES);
+    bool stressMode = false;
+    float broadphaseTime = 0.0f;    // Broadphase update time, averaged (ms)
+
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //----------------------------------------------------------
 
@@ -49,28 +116,60 @@ int main(void)
     {
         // Update
         //-----------------------------------------------------
-        // Move box if not paused
-        if (!pause) boxA.x += boxASpeedX;
+        if (IsKeyPressed(KEY_S)) stressMode = !stressMode;
+
+        if (stressMode)
+        {
+            // Move boxes if not paused, bouncing on move area limits
+            if (!pause)
+            {
+                for (int i = 0; i < STRESS_BOXES; i++)
+                {
+                    boxes[i].x += boxSpeeds[i].x;
+                    boxes[i].y += boxSpeeds[i].y;
+
+                    if (((boxes[i].x + boxes[i].width) >= screenWidth) || (boxes[i].x <= 0)) boxSpeeds[i].x *= -1;
+                    if (((boxes[i].y + boxes[i].height) >= screenHeight) || (boxes[i].y <= screenUpperLimit)) boxSpeeds[i].y *= -1;
+                }
+            }
+
+            // Find all overlapping boxes
+            double broadphaseStartTime = GetTime();
+            UpdateSweepAndPrune(&sap, boxes);
+            broadphaseTime = broadphaseTime*0.95f + (float)(GetTime() - broadphaseStartTime)*1000.0f*0.05f;
 
-        // Bounce box on x screen limits
-        if (((boxA.x + boxA.width) >= GetScreenWidth()) || (boxA.x <= 0)) boxASpeedX *= -1;
+            for (int i = 0; i < STRESS_BOXES; i++) boxColliding[i] = false;
+            for (int i = 0; i < sap.pairCount; i++)
+            {
+                boxColliding[sap.pairs[i].a] = true;
+                boxColliding[sap.pairs[i].b] = true;
+            }
+        }
+        else
+        {
+            // Move box if not paused
+            if (!pause) boxA.x += boxASpeedX;
+
+            // Bounce box on x screen limits
+            if (((boxA.x + boxA.width) >= GetScreenWidth()) || (boxA.x <= 0)) boxASpeedX *= -1;
 
-        // Update player-controlled-box (box02)
-        boxB.x = GetMouseX() - boxB.width/2;
-        boxB.y = GetMouseY() - boxB.height/2;
+            // Update player-controlled-box (box02)
+            boxB.x = GetMouseX() - boxB.width/2;
+            boxB.y = GetMouseY() - boxB.height/2;
 
-        // Make sure Box B does not go out of move area limits
-        if ((boxB.x + boxB.width) >= GetScreenWidth()) boxB.x = GetScreenWidth() - boxB.width;
-        else if (boxB.x <= 0) boxB.x = 0;
+            // Make sure Box B does not go out of move area limits
+            if ((boxB.x + boxB.width) >= GetScreenWidth()) boxB.x = GetScreenWidth() - boxB.width;
+            else if (boxB.x <= 0) boxB.x = 0;
 
-        if ((boxB.y + boxB.height) >= GetScreenHeight()) boxB.y = GetScreenHeight() - boxB.height;
-        else if (boxB.y <= screenUpperLimit) boxB.y = (float)screenUpperLimit;
+            if ((boxB.y + boxB.height) >= GetScreenHeight()) boxB.y = GetScreenHeight() - boxB.height;
+            else if (boxB.y <= screenUpperLimit) boxB.y = (float)screenUpperLimit;
 
-        // Check boxes collision
-        collision = CheckCollisionRecs(boxA, boxB);
+            // Check boxes collision
+            collision = CheckCollisionRecs(boxA, boxB);
 
-        // Get collision rectangle (only on collision)
-        if (collision) boxCollision = GetCollisionRec(boxA, boxB);
+            // Get collision rectangle (only on collision)
+            if (collision) boxCollision = GetCollisionRec(boxA, boxB);
+        }
 
         // Pause Box A movement
         if (IsKeyPressed(KEY_SPACE)) pause = !pause;
@@ -82,25 +181,39 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            DrawRectangle(0, 0, screenWidth, screenUpperLimit, collision? RED : BLACK);
+            if (stressMode)
+            {
+                for (int i = 0; i < STRESS_BOXES; i++) DrawRectangleRec(boxes[i], boxColliding[i]? RED : DARKBLUE);
 
-            DrawRectangleRec(boxA, GOLD);
-            DrawRectangleRec(boxB, BLUE);
+                DrawRectangle(0, 0, screenWidth, screenUpperLimit, BLACK);
+                DrawText(TextFormat("Boxes: %i - Overlapping pairs: %i", STRESS_BOXES, sap.pairCount), 120, 4, 10, RAYWHITE);
+                DrawText(TextFormat("Sweep and prune: %.2f ms - Endpoint swaps: %i", broadphaseTime, sap.swaps), 120, 20, 10, RAYWHITE);
 
-            if (collision)
+                DrawText("Press S to exit STRESS mode, SPACE to PAUSE/RESUME", 20, screenHeight - 35, 20, GRAY);
+            }
+            else
             {
-                // Draw collision area
-                DrawRectangleRec(boxCollision, LIME);
+                DrawRectangle(0, 0, screenWidth, screenUpperLimit, collision? RED : BLACK);
 
-                // Draw collision message
-                DrawText("COLLISION!", GetScreenWidth()/2 - MeasureText("COLLISION!", 20)/2, screenUpperLimit/2 - 10, 20, BLACK);
+                DrawRectangleRec(boxA, GOLD);
+                DrawRectangleRec(boxB, BLUE);
 
-                // Draw collision area
-                DrawText(TextFormat("Collision Area: %i", (int)boxCollision.width*(int)boxCollision.height), GetScreenWidth()/2 - 100, screenUpperLimit + 10, 20, BLACK);
-            }
+                if (collision)
+                {
+                    // Draw collision area
+                    DrawRectangleRec(boxCollision, LIME);
 
-            // Draw help instructions
-            DrawText("Press SPACE to PAUSE/RESUME", 20, screenHeight - 35, 20, LIGHTGRAY);
+                    // Draw collision message
+                    DrawText("COLLISION!", GetScreenWidth()/2 - MeasureText("COLLISION!", 20)/2, screenUpperLimit/2 - 10, 20, BLACK);
+
+                    // Draw collision area
+                    DrawText(TextFormat("Collision Area: %i", (int)boxCollision.width*(int)boxCollision.height), GetScreenWidth()/2 - 100, screenUpperLimit + 10, 20, BLACK);
+                }
+
+                // Draw help instructions
+                DrawText("Press SPACE to PAUSE/RESUME", 20, screenHeight - 35, 20, LIGHTGRAY);
+                DrawText("Press S for STRESS mode", 20, screenHeight - 60, 20, LIGHTGRAY);
+            }
 
             DrawFPS(10, 10);
 
@@ -110,8 +223,171 @@ int main(void)
 
     // De-Initialization
     //---------------------------------------------------------
+    UnloadSweepAndPrune(&sap);
+    RL_FREE(boxes);
+    RL_FREE(boxSpeeds);
+    RL_FREE(boxColliding);
+
     CloseWindow();        // Close window and OpenGL context
     //----------------------------------------------------------
 
     return 0;
 }
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Check if endpoint a goes before endpoint b on the sweep
+// NOTE: At the same position box ends go first, then boxes without width, then box starts,
+// so only boxes overlapping as in CheckCollisionRecs() are crossing the sweep together
+static bool EndpointBefore(SweepEndpoint a, SweepEndpoint b)
+{
+    if (a.value != b.value) return a.value < b.value;
+    if (a.tieOrder != b.tieOrder) return a.tieOrder < b.tieOrder;
+    if (a.box != b.box) return a.box < b.box;
+    return a.min && !b.min;
+}
+
+// Update endpoint position and order at its position from its box
+static void UpdateEndpoint(SweepEndpoint *endpoint, Rectangle box)
+{
+    endpoint->value = endpoint->min? box.x : box.x + box.width;
+    endpoint->tieOrder = (box.width <= 0)? 1 : (endpoint->min? 2 : 0);
+}
+
+// Compare endpoints for qsort()
+static int CompareEndpoints(const void *a, const void *b)
+{
+    const SweepEndpoint *endpointA = (const SweepEndpoint *)a;
+    const SweepEndpoint *endpointB = (const SweepEndpoint *)b;
+
+    if (EndpointBefore(*endpointA, *endpointB)) return -1;
+    if (EndpointBefore(*endpointB, *endpointA)) return 1;
+    return 0;
+}
+
+// Init sweep and prune broadphase for the provided boxes
+// NOTE: Only the first sort is a full one, next updates insertion sort the endpoints
+static SweepAndPrune InitSweepAndPrune(const Rectangle *boxes, int boxCount)
+{
+    SweepAndPrune sap = { 0 };
+
+    sap.boxCount = boxCount;
+    sap.endpoints = (SweepEndpoint *)RL_CALLOC(2*boxCount, sizeof(SweepEndpoint));
+    sap.activeBoxes = (int *)RL_CALLOC(boxCount, sizeof(int));
+    sap.activeMinY = (float *)RL_CALLOC(boxCount, sizeof(float));
+    sap.activeMaxY = (float *)RL_CALLOC(boxCount, sizeof(float));
+    sap.activePositions = (int *)RL_CALLOC(boxCount, sizeof(int));
+
+    for (int i = 0; i < boxCount; i++)
+    {
+        sap.endpoints[2*i] = (SweepEndpoint){ .box = i, .min = true };
+        sap.endpoints[2*i + 1] = (SweepEndpoint){ .box = i, .min = false };
+        UpdateEndpoint(&sap.endpoints[2*i], boxes[i]);
+        UpdateEndpoint(&sap.endpoints[2*i + 1], boxes[i]);
+    }
+
+    qsort(sap.endpoints, 2*boxCount, sizeof(SweepEndpoint), CompareEndpoints);
+
+    return sap;
+}
+
+// Reserve space for overlapping pairs on the broadphase results
+static void ReserveCollisionPairs(SweepAndPrune *sap, int capacity)
+{
+    if (sap->pairCapacity == 0) sap->pairCapacity = 1024;
+    while (sap->pairCapacity < capacity) sap->pairCapacity *= 2;
+
+    sap->pairs = (CollisionPair *)RL_REALLOC(sap->pairs, sap->pairCapacity*sizeof(CollisionPair));
+}
+
+// Update sweep and prune broadphase with the boxes new positions, returns overlapping pairs found
+// NOTE: Boxes overlapping on x are found sweeping the sorted endpoints,
+// they are only reported if they also overlap on y, same result as CheckCollisionRecs() on every pair,
+// boxes with negative width or height are not supported
+static int UpdateSweepAndPrune(SweepAndPrune *sap, const Rectangle *boxes)
+{
+    int endpointCount = 2*sap->boxCount;
+
+    // Update endpoints positions
+    for (int i = 0; i < endpointCount; i++) UpdateEndpoint(&sap->endpoints[i], boxes[sap->endpoints[i].box]);
+
+    // Insertion sort endpoints, almost sorted from the previous frame
+    sap->swaps = 0;
+    for (int i = 1; i < endpointCount; i++)
+    {
+        SweepEndpoint endpoint = sap->endpoints[i];
+        int j = i - 1;
+
+        while ((j >= 0) && EndpointBefore(endpoint, sap->endpoints[j]))
+        {
+            sap->endpoints[j + 1] = sap->endpoints[j];
+            j--;
+        }
+
+        sap->endpoints[j + 1] = endpoint;
+        sap->swaps += i - 1 - j;
+    }
+
+    // Sweep endpoints, every box starting is checked on y against the active boxes
+    int activeCount = 0;
+    sap->pairCount = 0;
+
+    for (int i = 0; i < endpointCount; i++)
+    {
+        int box = sap->endpoints[i].box;
+
+        if (sap->endpoints[i].min)
+        {
+            float minY = boxes[box].y;
+            float maxY = boxes[box].y + boxes[box].height;
+
+            // Every active box is written as a pair, only the ones overlapping on y are kept
+            // NOTE: Without a branch on the overlap test the loop does not suffer mispredictions
+            if (sap->pairCount + activeCount > sap->pairCapacity) ReserveCollisionPairs(sap, sap->pairCount + activeCount);
+
+            CollisionPair *pairs = sap->pairs;
+            int pairCount = sap->pairCount;
+
+            for (int k = 0; k < activeCount; k++)
+            {
+                pairs[pairCount] = (CollisionPair){ sap->activeBoxes[k], box };
+                pairCount += (minY < sap->activeMaxY[k]) & (maxY > sap->activeMinY[k]);
+            }
+
+            sap->pairCount = pairCount;
+
+            sap->activeBoxes[activeCount] = box;
+            sap->activeMinY[activeCount] = minY;
+            sap->activeMaxY[activeCount] = maxY;
+            sap->activePositions[box] = activeCount;
+            activeCount++;
+        }
+        else
+        {
+            // Remove box from the active list, last active box takes its place
+            int position = sap->activePositions[box];
+            activeCount--;
+
+            sap->activeBoxes[position] = sap->activeBoxes[activeCount];
+            sap->activeMinY[position] = sap->activeMinY[activeCount];
+            sap->activeMaxY[position] = sap->activeMaxY[activeCount];
+            sap->activePositions[sap->activeBoxes[position]] = position;
+        }
+    }
+
+    return sap->pairCount;
+}
+
+// Unload sweep and prune broadphase
+static void UnloadSweepAndPrune(SweepAndPrune *sap)
+{
+    RL_FREE(sap->endpoints);
+    RL_FREE(sap->activeBoxes);
+    RL_FREE(sap->activeMinY);
+    RL_FREE(sap->activeMaxY);
+    RL_FREE(sap->activePositions);
+    RL_FREE(sap->pairs);
+
+    *sap = (SweepAndPrune){ 0 };
+}
@@ -16,19 +16,149 @@
 ********************************************************************************************/
 
 #include "raylib.h"
-
-#include <math.h>       // Required for: sin(), cos(), PI
+#include "raymath.h"        // Required for: MatrixIdentity()
+#include "rlgl.h"           // Required for: rlDisableBackfaceCulling(), rlEnableBackfaceCulling()
+
+#include <math.h>           // Required for: sin(), cos(), sqrtf(), PI
+#include <stdatomic.h>      // Required for: atomic_fetch_add()
+
+#include "pthread.h"        // POSIX style threads management
+
+#if !defined(_WIN32)
+    #include <unistd.h>     // Required for: sysconf()
+#endif
+
+// Ensemble kernel instruction set, selected at compile time (-mavx enables the 8-wide path)
+#if defined(__AVX__)
+    #include <immintrin.h>  // Required for: AVX intrinsics
+    #define PENDULUM_SIMD_WIDTH 8
+    #define PENDULUM_SIMD_NAME "AVX"
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #define PENDULUM_SIMD_WIDTH 4
+    #define PENDULUM_SIMD_NAME "SSE2"
+#else
+    #define PENDULUM_SIMD_WIDTH 1   // No SIMD instruction set available, the SIMD path runs the scalar kernel
+    #define PENDULUM_SIMD_NAME "none"
+#endif
+
+// SIMD operations used by the ensemble kernel, PENDULUM_SIMD_WIDTH lanes
+#if (PENDULUM_SIMD_WIDTH == 8)
+    #define SIMD_FLOAT __m256
+    #define SIMD_SET(value) _mm256_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm256_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm256_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm256_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm256_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm256_mul_ps(a, b)
+    #define SIMD_DIV(a, b) _mm256_div_ps(a, b)
+    #define SIMD_MIN(a, b) _mm256_min_ps(a, b)
+    #define SIMD_MAX(a, b) _mm256_max_ps(a, b)
+    #define SIMD_ROUND(a) _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)
+#elif (PENDULUM_SIMD_WIDTH == 4)
+    #define SIMD_FLOAT __m128
+    #define SIMD_SET(value) _mm_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm_mul_ps(a, b)
+    #define SIMD_DIV(a, b) _mm_div_ps(a, b)
+    #define SIMD_MIN(a, b) _mm_min_ps(a, b)
+    #define SIMD_MAX(a, b) _mm_max_ps(a, b)
+    #define SIMD_ROUND(a) _mm_cvtepi32_ps(_mm_cvtps_epi32(a))
+#endif
 
 // Constant for Simulation
 #define SIMULATION_STEPS 30
 #define G 9.81f
 
+#define MAX_PENDULUMS 131072        // Max pendulums of the ensemble
+#define ENSEMBLE_STEPS 8            // RK4 steps per frame of every ensemble pendulum
+#define ENSEMBLE_SPREAD (DEG2RAD*1.0f)  // Initial upper angle range of the ensemble, around the single pendulum one
+#define PENDULUM_CHUNK_SIZE 2048    // Pendulums updated per job
+
+#define MAX_JOB_WORKERS 32          // Max threads running the ensemble update, the main thread included
+#define TRAIL_THICK 1.5f            // Ensemble trails line thickness
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Double pendulum physical parameters, shared by all the pendulums of the ensemble
+typedef struct PendulumParams {
+    float m1, m2;           // Masses
+    float L1, L2;           // Scaled lengths, used by the simulation
+    float l1, l2;           // Lengths, used to draw
+    Vector2 pivot;          // Upper pendulum pivot on screen
+} PendulumParams;
+
+// Pendulums ensemble, every pendulum component is stored in its own array (structure of arrays)
+// so the RK4 kernel steps 4 or 8 pendulums per instruction
+typedef struct PendulumEnsemble {
+    float *theta1;          // Upper pendulum angle
+    float *theta2;          // Lower pendulum angle
+    float *omega1;          // Upper pendulum angular velocity
+    float *omega2;          // Lower pendulum angular velocity
+    float *endX;            // Lower pendulum end point on screen, after the last update
+    float *endY;
+    int count;
+    int capacity;
+
+    Mesh trails;            // Last move of every pendulum end point, one line quad per pendulum
+} PendulumEnsemble;
+
+// Ensemble update kernel, steps pendulums [start, start + count) and computes their end points
+typedef void (*PendulumKernel)(PendulumEnsemble *ensemble, const PendulumParams *params, int start, int count, float step, int steps);
+
+typedef void (*JobFunc)(void *data, int job);
+
+// Job system, the thread submitting a batch runs the jobs too
+// NOTE: All the ensemble jobs cost the same, so workers just take the next job from a shared counter
+typedef struct JobSystem {
+    pthread_t threads[MAX_JOB_WORKERS];
+    int workerCount;        // Workers available, threads started + 1
+    JobFunc func;           // Job of the current batch...
+    void *data;             // ...and its data
+    int jobCount;
+    _Atomic int nextJob;    // Next job of the current batch to be taken
+    unsigned int batch;     // Protected by mutex, increased for every batch
+    int pending;            // Protected by mutex, worker threads still running the current batch
+    bool quit;              // Protected by mutex
+    pthread_mutex_t mutex;
+    pthread_cond_t batchStarted;
+    pthread_cond_t batchDone;
+} JobSystem;
+
+// Ensemble update batch data
+typedef struct PendulumJobs {
+    PendulumEnsemble *ensemble;
+    const PendulumParams *params;
+    PendulumKernel kernel;
+    float step;
+} PendulumJobs;
+
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
 static Vector2 CalculatePendulumEndPoint(float l, float theta);
 static Vector2 CalculateDoublePendulumEndPoint(float l1, float theta1, float l2, float theta2);
 
+static PendulumEnsemble LoadPendulumEnsemble(int capacity);
+static void UnloadPendulumEnsemble(PendulumEnsemble *ensemble);
+static void ResetPendulumEnsemble(PendulumEnsemble *ensemble, const PendulumParams *params, int count, float theta1, float theta2);
+static void StepPendulumsScalar(PendulumEnsemble *ensemble, const PendulumParams *params, int start, int count, float step, int steps);
+static void StepPendulumsSIMD(PendulumEnsemble *ensemble, const PendulumParams *params, int start, int count, float step, int steps);
+static void UpdatePendulumEnsemble(PendulumEnsemble *ensemble, const PendulumParams *params, PendulumKernel kernel, float step, bool threaded);
+
+static void StartJobSystem(int workerCount);
+static void StopJobSystem(void);
+static void RunJobs(JobFunc func, void *data, int jobCount, bool threaded);
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static JobSystem jobs = { 0 };
+
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -64,6 +194,27 @@ int main(void)
     RenderTexture2D target = LoadRenderTexture(screenWidth, screenHeight);
     SetTextureFilter(target.texture, TEXTURE_FILTER_BILINEAR);
 
+    // Ensemble of pendulums with slightly different initial angles, all of them with the same parameters
+    PendulumParams params = { m1, m2, L1, L2, l1, l2, { screenWidth/2.0f, screenHeight/2.0f - 100 } };
+    PendulumEnsemble ensemble = LoadPendulumEnsemble(MAX_PENDULUMS);
+    ResetPendulumEnsemble(&ensemble, &params, 20000, DEG2RAD*170, DEG2RAD*0);
+
+    // Trails are drawn in a single call, colored by the initial angle of every pendulum
+    Material trailsMaterial = LoadMaterialDefault();
+
+    bool ensembleMode = false;
+    bool updateWithSIMD = true;         // Switch between the SIMD and the scalar RK4 kernel
+    bool updateWithThreads = true;      // Split the update across the job system workers
+    double updateTime = 0.0;            // Ensemble update time, averaged (ms)
+
+    // Job system, one worker per core
+#if defined(_SC_NPROCESSORS_ONLN)
+    int coreCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#else
+    int coreCount = 4;
+#endif
+    StartJobSystem((coreCount < MAX_JOB_WORKERS)? coreCount : MAX_JOB_WORKERS);
+
     SetTargetFPS(60);
     //--------------------------------------------------------------------------------------
 
@@ -72,35 +223,66 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
-        float dt = GetFrameTime();
-        float step = dt/SIMULATION_STEPS, step2 = step*step;
+        bool resetTrails = false;
 
-        // Update Physics - larger steps = better approximation
-        for (int i = 0; i < SIMULATION_STEPS; ++i)
+        if (IsKeyPressed(KEY_E))
         {
-            float delta = theta1 - theta2;
-            float sinD = sinf(delta), cosD = cosf(delta), cos2D = cosf(2*delta);
-            float ww1 = w1*w1, ww2 = w2*w2;
-
-            // Calculate a1
-            float a1 = (-G*(2*m1 + m2)*sinf(theta1)
-                         - m2*G*sinf(theta1 - 2*theta2)
-                         - 2*sinD*m2*(ww2*L2 + ww1*L1*cosD))
-                        /(L1*(2*m1 + m2 - m2*cos2D));
-
-            // Calculate a2
-            float a2 = (2*sinD*(ww1*L1*totalM
-                         + G*totalM*cosf(theta1)
-                         + ww2*L2*m2*cosD))
-                        /(L2*(2*m1 + m2 - m2*cos2D));
-
-            // Update thetas
-            theta1 += w1*step + 0.5f*a1*step2;
-            theta2 += w2*step + 0.5f*a2*step2;
-
-            // Update omegas
-            w1 += a1*step;
-            w2 += a2*step;
+            ensembleMode = !ensembleMode;
+            resetTrails = true;
+        }
+
+        if (ensembleMode)
+        {
+            int count = ensemble.count;
+            if (IsKeyPressed(KEY_UP) && (count < MAX_PENDULUMS)) count = (count*2 < MAX_PENDULUMS)? count*2 : MAX_PENDULUMS;
+            if (IsKeyPressed(KEY_DOWN) && (count > 1000)) count /= 2;
+
+            if (IsKeyPressed(KEY_R) || (count != ensemble.count))
+            {
+                ResetPendulumEnsemble(&ensemble, &params, count, DEG2RAD*170, DEG2RAD*0);
+                resetTrails = true;
+            }
+
+            if (IsKeyPressed(KEY_V)) updateWithSIMD = !updateWithSIMD;
+            if (IsKeyPressed(KEY_T)) updateWithThreads = !updateWithThreads;
+
+            // Fixed time step, so the benchmark always runs the same work
+            double updateStartTime = GetTime();
+            UpdatePendulumEnsemble(&ensemble, &params, updateWithSIMD? StepPendulumsSIMD : StepPendulumsScalar, (1.0f/60.0f)/ENSEMBLE_STEPS, updateWithThreads);
+            updateTime = updateTime*0.9 + (GetTime() - updateStartTime)*1000.0*0.1;
+        }
+        else
+        {
+            float dt = GetFrameTime();
+            float step = dt/SIMULATION_STEPS, step2 = step*step;
+
+            // Update Physics - larger steps = better approximation
+            for (int i = 0; i < SIMULATION_STEPS; ++i)
+            {
+                float delta = theta1 - theta2;
+                float sinD = sinf(delta), cosD = cosf(delta), cos2D = cosf(2*delta);
+                float ww1 = w1*w1, ww2 = w2*w2;
+
+                // Calculate a1
+                float a1 = (-G*(2*m1 + m2)*sinf(theta1)
+                             - m2*G*sinf(theta1 - 2*theta2)
+                             - 2*sinD*m2*(ww2*L2 + ww1*L1*cosD))
+                            /(L1*(2*m1 + m2 - m2*cos2D));
+
+                // Calculate a2
+                float a2 = (2*sinD*(ww1*L1*totalM
+                             + G*totalM*cosf(theta1)
+                             + ww2*L2*m2*cosD))
+                            /(L2*(2*m1 + m2 - m2*cos2D));
+
+                // Update thetas
+                theta1 += w1*step + 0.5f*a1*step2;
+                theta2 += w2*step + 0.5f*a2*step2;
+
+                // Update omegas
+                w1 += a1*step;
+                w2 += a2*step;
+            }
         }
 
         // Calculate position
@@ -110,12 +292,23 @@ int main(void)
 
         // Draw to render texture
         BeginTextureMode(target);
+            if (resetTrails) ClearBackground(BLANK);
+
             // Draw a transparent rectangle - smaller alpha = longer trails
             DrawRectangle(0, 0, screenWidth, screenHeight, Fade(BLACK, fateAlpha));
 
             // Draw trail
-            DrawCircleV(previousPosition, trailThick, RED);
-            DrawLineEx(previousPosition, currentPosition, trailThick*2, RED);
+            if (ensembleMode)
+            {
+                rlDisableBackfaceCulling();
+                DrawMesh(ensemble.trails, trailsMaterial, MatrixIdentity());
+                rlEnableBackfaceCulling();
+            }
+            else
+            {
+                DrawCircleV(previousPosition, trailThick, RED);
+                DrawLineEx(previousPosition, currentPosition, trailThick*2, RED);
+            }
         EndTextureMode();
 
         // Update previous position
@@ -131,13 +324,28 @@ int main(void)
             // Draw trails texture
             DrawTextureRec(target.texture, (Rectangle){ 0, 0, (float)target.texture.width, (float)-target.texture.height }, (Vector2){ 0, 0 }, WHITE);
 
-            // Draw double pendulum
+            // Draw double pendulum, the first one of the ensemble on ensemble mode
+            float drawTheta1 = ensembleMode? ensemble.theta1[0] : theta1;
+            float drawTheta2 = ensembleMode? ensemble.theta2[0] : theta2;
+
             DrawRectanglePro((Rectangle){ screenWidth/2.0f, screenHeight/2.0f - 100, 10*l1, lineThick },
-                (Vector2){0, lineThick*0.5f}, 90 - RAD2DEG*theta1, RAYWHITE);
+                (Vector2){0, lineThick*0.5f}, 90 - RAD2DEG*drawTheta1, ensembleMode? Fade(RAYWHITE, 0.3f) : RAYWHITE);
 
-            Vector2 endpoint1 = CalculatePendulumEndPoint(l1, theta1);
+            Vector2 endpoint1 = CalculatePendulumEndPoint(l1, drawTheta1);
             DrawRectanglePro((Rectangle){ screenWidth/2.0f + endpoint1.x, screenHeight/2.0f - 100 + endpoint1.y, 10*l2, lineThick },
-                (Vector2){0, lineThick*0.5f}, 90 - RAD2DEG*theta2, RAYWHITE);
+                (Vector2){0, lineThick*0.5f}, 90 - RAD2DEG*drawTheta2, ensembleMode? Fade(RAYWHITE, 0.3f) : RAYWHITE);
+
+            if (ensembleMode)
+            {
+                DrawRectangle(10, 10, 250, 115, Fade(BLACK, 0.6f));
+                DrawText(TextFormat("Pendulums: %i", ensemble.count), 20, 20, 10, RAYWHITE);
+                DrawText(TextFormat("RK4 kernel: %s", updateWithSIMD? TextFormat("SIMD (%s)", PENDULUM_SIMD_NAME) : "scalar"), 20, 35, 10, RAYWHITE);
+                DrawText(TextFormat("Update threads: %i", updateWithThreads? jobs.workerCount : 1), 20, 50, 10, RAYWHITE);
+                DrawText(TextFormat("Update: %.2f ms, %.1f M steps/s", updateTime, (updateTime > 0.0)? ensemble.count*ENSEMBLE_STEPS/(updateTime*1000.0) : 0.0), 20, 65, 10, GREEN);
+                DrawText("(UP/DOWN) Pendulums, (R) Restart", 20, 85, 10, LIGHTGRAY);
+                DrawText("(V) Kernel, (T) Threads, (E) Single pendulum", 20, 100, 10, LIGHTGRAY);
+            }
+            else DrawText("(E) Ensemble of pendulums", 10, 10, 10, LIGHTGRAY);
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -145,6 +353,9 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    StopJobSystem();                // Stop worker threads
+    UnloadPendulumEnsemble(&ensemble);
+    UnloadMaterial(trailsMaterial);
     UnloadRenderTexture(target);
 
     CloseWindow();        // Close window and OpenGL context
@@ -169,3 +380,369 @@ static Vector2 CalculateDoublePendulumEndPoint(float l1, float theta1, float l2,
     Vector2 endpoint2 = CalculatePendulumEndPoint(l2, theta2);
     return (Vector2){ endpoint1.x + endpoint2.x, endpoint1.y + endpoint2.y };
 }
+
+// Load pendulums ensemble, all arrays allocated for capacity pendulums
+// NOTE: The trails mesh is uploaded once for the full capacity, only the pendulums vertices are updated and drawn
+static PendulumEnsemble LoadPendulumEnsemble(int capacity)
+{
+    PendulumEnsemble ensemble = { 0 };
+
+    ensemble.theta1 = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.theta2 = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.omega1 = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.omega2 = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.endX = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.endY = (float *)RL_CALLOC(capacity, sizeof(float));
+    ensemble.capacity = capacity;
+
+    ensemble.trails.vertexCount = capacity*6;
+    ensemble.trails.triangleCount = capacity*2;
+    ensemble.trails.vertices = (float *)RL_CALLOC(capacity*6*3, sizeof(float));
+    ensemble.trails.colors = (unsigned char *)RL_CALLOC(capacity*6*4, sizeof(unsigned char));
+    UploadMesh(&ensemble.trails, true);
+
+    return ensemble;
+}
+
+// Unload pendulums ensemble
+static void UnloadPendulumEnsemble(PendulumEnsemble *ensemble)
+{
+    RL_FREE(ensemble->theta1);
+    RL_FREE(ensemble->theta2);
+    RL_FREE(ensemble->omega1);
+    RL_FREE(ensemble->omega2);
+    RL_FREE(ensemble->endX);
+    RL_FREE(ensemble->endY);
+    UnloadMesh(ensemble->trails);
+
+    *ensemble = (PendulumEnsemble){ 0 };
+}
+
+// Reset the ensemble to count pendulums at rest, upper angles spread over ENSEMBLE_SPREAD around theta1
+// NOTE: Pendulums are colored by their initial angle, so the chaotic divergence of the ensemble is visible
+static void ResetPendulumEnsemble(PendulumEnsemble *ensemble, const PendulumParams *params, int count, float theta1, float theta2)
+{
+    if (count > ensemble->capacity) count = ensemble->capacity;
+
+    for (int i = 0; i < count; i++)
+    {
+        ensemble->theta1[i] = theta1 + ENSEMBLE_SPREAD*((float)i/count - 0.5f);
+        ensemble->theta2[i] = theta2;
+        ensemble->omega1[i] = 0.0f;
+        ensemble->omega2[i] = 0.0f;
+
+        Vector2 end = CalculateDoublePendulumEndPoint(params->l1, ensemble->theta1[i], params->l2, theta2);
+        ensemble->endX[i] = params->pivot.x + end.x;
+        ensemble->endY[i] = params->pivot.y + end.y;
+
+        Color color = ColorFromHSV(300.0f*i/count, 0.8f, 1.0f);
+        color.a = 120;
+        for (int v = 0; v < 6; v++) ((Color *)ensemble->trails.colors)[i*6 + v] = color;
+    }
+
+    ensemble->count = count;
+    UpdateMeshBuffer(ensemble->trails, 3, ensemble->trails.colors, count*6*4, 0);
+}
+
+// Double pendulum angular accelerations
+static inline void CalculatePendulumAcceleration(const PendulumParams *params, float theta1, float theta2, float w1, float w2, float *a1, float *a2)
+{
+    float m1 = params->m1, m2 = params->m2, L1 = params->L1, L2 = params->L2;
+    float totalM = m1 + m2;
+    float delta = theta1 - theta2;
+    float sinD = sinf(delta), cosD = cosf(delta), cos2D = cosf(2*delta);
+    float ww1 = w1*w1, ww2 = w2*w2;
+    float denominator = 2*m1 + m2 - m2*cos2D;
+
+    *a1 = (-G*(2*m1 + m2)*sinf(theta1) - m2*G*sinf(theta1 - 2*theta2) - 2*sinD*m2*(ww2*L2 + ww1*L1*cosD))/(L1*denominator);
+    *a2 = (2*sinD*(ww1*L1*totalM + G*totalM*cosf(theta1) + ww2*L2*m2*cosD))/(L2*denominator);
+}
+
+// Ensemble RK4 kernel, one pendulum at a time
+static void StepPendulumsScalar(PendulumEnsemble *ensemble, const PendulumParams *params, int start, int count, float step, int steps)
+{
+    for (int i = start; i < (start + count); i++)
+    {
+        float t1 = ensemble->theta1[i], t2 = ensemble->theta2[i];
+        float w1 = ensemble->omega1[i], w2 = ensemble->omega2[i];
+
+        for (int s = 0; s < steps; s++)
+        {
+            float a11, a21, a12, a22, a13, a23, a14, a24;
+
+            CalculatePendulumAcceleration(params, t1, t2, w1, w2, &a11, &a21);
+
+            float w12 = w1 + 0.5f*step*a11, w22 = w2 + 0.5f*step*a21;
+            CalculatePendulumAcceleration(params, t1 + 0.5f*step*w1, t2 + 0.5f*step*w2, w12, w22, &a12, &a22);
+
+            float w13 = w1 + 0.5f*step*a12, w23 = w2 + 0.5f*step*a22;
+            CalculatePendulumAcceleration(params, t1 + 0.5f*step*w12, t2 + 0.5f*step*w22, w13, w23, &a13, &a23);
+
+            float w14 = w1 + step*a13, w24 = w2 + step*a23;
+            CalculatePendulumAcceleration(params, t1 + step*w13, t2 + step*w23, w14, w24, &a14, &a24);
+
+            t1 += step/6.0f*(w1 + 2*w12 + 2*w13 + w14);
+            t2 += step/6.0f*(w2 + 2*w22 + 2*w23 + w24);
+            w1 += step/6.0f*(a11 + 2*a12 + 2*a13 + a14);
+            w2 += step/6.0f*(a21 + 2*a22 + 2*a23 + a24);
+        }
+
+        ensemble->theta1[i] = t1;
+        ensemble->theta2[i] = t2;
+        ensemble->omega1[i] = w1;
+        ensemble->omega2[i] = w2;
+
+        ensemble->endX[i] = params->pivot.x + 10*params->l1*sinf(t1) + 10*params->l2*sinf(t2);
+        ensemble->endY[i] = params->pivot.y + 10*params->l1*cosf(t1) + 10*params->l2*cosf(t2);
+    }
+}
+
+#if (PENDULUM_SIMD_WIDTH > 1)
+// Sine of every lane, error below 1e-6 for the angles of a pendulum
+// NOTE: The angle is reduced to [-PI, PI], folded to [-PI/2, PI/2] with sin(x) = sin(PI - x)
+// and evaluated with the Taylor series up to x^11
+static inline SIMD_FLOAT SimdSin(SIMD_FLOAT x)
+{
+    x = SIMD_SUB(x, SIMD_MUL(SIMD_ROUND(SIMD_MUL(x, SIMD_SET(1.0f/(2.0f*PI)))), SIMD_SET(2.0f*PI)));
+    x = SIMD_MIN(x, SIMD_SUB(SIMD_SET(PI), x));
+    x = SIMD_MAX(x, SIMD_SUB(SIMD_SET(-PI), x));
+
+    SIMD_FLOAT x2 = SIMD_MUL(x, x);
+    SIMD_FLOAT p = SIMD_SET(-1.0f/39916800.0f);
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f/362880.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(-1.0f/5040.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f/120.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(-1.0f/6.0f));
+    p = SIMD_ADD(SIMD_MUL(p, x2), SIMD_SET(1.0f));
+
+    return SIMD_MUL(p, x);
+}
+
+// Double pendulum angular accelerations of every lane
+// NOTE: Angle differences are expanded with the sum identities, only the sine and cosine of both angles are evaluated
+static inline void CalculatePendulumAccelerationSIMD(const PendulumParams *params, SIMD_FLOAT theta1, SIMD_FLOAT theta2, SIMD_FLOAT w1, SIMD_FLOAT w2, SIMD_FLOAT *a1, SIMD_FLOAT *a2)
+{
+    const float m1 = params->m1, m2 = params->m2, L1 = params->L1, L2 = params->L2;
+    const float totalM = m1 + m2;
+
+    SIMD_FLOAT sin1 = SimdSin(theta1), cos1 = SimdSin(SIMD_ADD(theta1, SIMD_SET(PI/2.0f)));
+    SIMD_FLOAT sin2 = SimdSin(theta2), cos2 = SimdSin(SIMD_ADD(theta2, SIMD_SET(PI/2.0f)));
+
+    SIMD_FLOAT sinD = SIMD_SUB(SIMD_MUL(sin1, cos2), SIMD_MUL(cos1, sin2));
+    SIMD_FLOAT cosD = SIMD_ADD(SIMD_MUL(cos1, cos2), SIMD_MUL(sin1, sin2));
+    SIMD_FLOAT cos2D = SIMD_SUB(SIMD_MUL(SIMD_SET(2.0f), SIMD_MUL(cosD, cosD)), SIMD_SET(1.0f));
+    SIMD_FLOAT sin12 = SIMD_SUB(SIMD_MUL(sinD, cos2), SIMD_MUL(cosD, sin2));     // sin(theta1 - 2*theta2)
+    SIMD_FLOAT ww1 = SIMD_MUL(w1, w1), ww2 = SIMD_MUL(w2, w2);
+    SIMD_FLOAT denominator = SIMD_SUB(SIMD_SET(2*m1 + m2), SIMD_MUL(SIMD_SET(m2), cos2D));
+
+    // a1 = (-G*(2*m1 + m2)*sin1 - m2*G*sin12 - 2*sinD*m2*(ww2*L2 + ww1*L1*cosD))/(L1*denominator)
+    SIMD_FLOAT n1 = SIMD_ADD(SIMD_MUL(SIMD_SET(-G*(2*m1 + m2)), sin1), SIMD_MUL(SIMD_SET(-m2*G), sin12));
+    SIMD_FLOAT inner1 = SIMD_ADD(SIMD_MUL(ww2, SIMD_SET(L2)), SIMD_MUL(SIMD_MUL(ww1, SIMD_SET(L1)), cosD));
+    n1 = SIMD_SUB(n1, SIMD_MUL(SIMD_MUL(SIMD_SET(2*m2), sinD), inner1));
+    *a1 = SIMD_DIV(n1, SIMD_MUL(SIMD_SET(L1), denominator));
+
+    // a2 = (2*sinD*(ww1*L1*totalM + G*totalM*cos1 + ww2*L2*m2*cosD))/(L2*denominator)
+    SIMD_FLOAT inner2 = SIMD_ADD(SIMD_MUL(ww1, SIMD_SET(L1*totalM)), SIMD_MUL(SIMD_SET(G*totalM), cos1));
+    inner2 = SIMD_ADD(inner2, SIMD_MUL(SIMD_MUL(ww2, SIMD_SET(L2*m2)), cosD));
+    *a2 = SIMD_DIV(SIMD_MUL(SIMD_MUL(SIMD_SET(2.0f), sinD), inner2), SIMD_MUL(SIMD_SET(L2), denominator));
+}
+#endif
+
+// Ensemble RK4 kernel, PENDULUM_SIMD_WIDTH pendulums at a time, the remainder with the scalar kernel
+static void StepPendulumsSIMD(PendulumEnsemble *ensemble, const PendulumParams *params, int start, int count, float step, int steps)
+{
+    int i = start;
+
+#if (PENDULUM_SIMD_WIDTH > 1)
+    const SIMD_FLOAT half = SIMD_SET(0.5f*step);
+    const SIMD_FLOAT full = SIMD_SET(step);
+    const SIMD_FLOAT sixth = SIMD_SET(step/6.0f);
+    const SIMD_FLOAT two = SIMD_SET(2.0f);
+
+    for (; i <= (start + count - PENDULUM_SIMD_WIDTH); i += PENDULUM_SIMD_WIDTH)
+    {
+        SIMD_FLOAT t1 = SIMD_LOAD(ensemble->theta1 + i), t2 = SIMD_LOAD(ensemble->theta2 + i);
+        SIMD_FLOAT w1 = SIMD_LOAD(ensemble->omega1 + i), w2 = SIMD_LOAD(ensemble->omega2 + i);
+
+        for (int s = 0; s < steps; s++)
+        {
+            SIMD_FLOAT a11, a21, a12, a22, a13, a23, a14, a24;
+
+            CalculatePendulumAccelerationSIMD(params, t1, t2, w1, w2, &a11, &a21);
+
+            SIMD_FLOAT w12 = SIMD_ADD(w1, SIMD_MUL(half, a11)), w22 = SIMD_ADD(w2, SIMD_MUL(half, a21));
+            CalculatePendulumAccelerationSIMD(params, SIMD_ADD(t1, SIMD_MUL(half, w1)), SIMD_ADD(t2, SIMD_MUL(half, w2)), w12, w22, &a12, &a22);
+
+            SIMD_FLOAT w13 = SIMD_ADD(w1, SIMD_MUL(half, a12)), w23 = SIMD_ADD(w2, SIMD_MUL(half, a22));
+            CalculatePendulumAccelerationSIMD(params, SIMD_ADD(t1, SIMD_MUL(half, w12)), SIMD_ADD(t2, SIMD_MUL(half, w22)), w13, w23, &a13, &a23);
+
+            SIMD_FLOAT w14 = SIMD_ADD(w1, SIMD_MUL(full, a13)), w24 = SIMD_ADD(w2, SIMD_MUL(full, a23));
+            CalculatePendulumAccelerationSIMD(params, SIMD_ADD(t1, SIMD_MUL(full, w13)), SIMD_ADD(t2, SIMD_MUL(full, w23)), w14, w24, &a14, &a24);
+
+            t1 = SIMD_ADD(t1, SIMD_MUL(sixth, SIMD_ADD(SIMD_ADD(w1, w14), SIMD_MUL(two, SIMD_ADD(w12, w13)))));
+            t2 = SIMD_ADD(t2, SIMD_MUL(sixth, SIMD_ADD(SIMD_ADD(w2, w24), SIMD_MUL(two, SIMD_ADD(w22, w23)))));
+            w1 = SIMD_ADD(w1, SIMD_MUL(sixth, SIMD_ADD(SIMD_ADD(a11, a14), SIMD_MUL(two, SIMD_ADD(a12, a13)))));
+            w2 = SIMD_ADD(w2, SIMD_MUL(sixth, SIMD_ADD(SIMD_ADD(a21, a24), SIMD_MUL(two, SIMD_ADD(a22, a23)))));
+        }
+
+        SIMD_STORE(ensemble->theta1 + i, t1);
+        SIMD_STORE(ensemble->theta2 + i, t2);
+        SIMD_STORE(ensemble->omega1 + i, w1);
+        SIMD_STORE(ensemble->omega2 + i, w2);
+
+        SIMD_FLOAT r1 = SIMD_SET(10*params->l1), r2 = SIMD_SET(10*params->l2);
+        SIMD_FLOAT endX = SIMD_ADD(SIMD_MUL(r1, SimdSin(t1)), SIMD_MUL(r2, SimdSin(t2)));
+        SIMD_FLOAT endY = SIMD_ADD(SIMD_MUL(r1, SimdSin(SIMD_ADD(t1, SIMD_SET(PI/2.0f)))), SIMD_MUL(r2, SimdSin(SIMD_ADD(t2, SIMD_SET(PI/2.0f)))));
+        SIMD_STORE(ensemble->endX + i, SIMD_ADD(endX, SIMD_SET(params->pivot.x)));
+        SIMD_STORE(ensemble->endY + i, SIMD_ADD(endY, SIMD_SET(params->pivot.y)));
+    }
+#endif
+
+    if (i < (start + count)) StepPendulumsScalar(ensemble, params, i, start + count - i, step, steps);
+}
+
+// Update job, steps a chunk of pendulums and writes their trail line quads
+// NOTE: Every chunk only writes its own pendulums and vertices, jobs never share data
+static void UpdatePendulumChunk(void *data, int job)
+{
+    PendulumJobs *pendulumJobs = (PendulumJobs *)data;
+    PendulumEnsemble *ensemble = pendulumJobs->ensemble;
+
+    int start = job*PENDULUM_CHUNK_SIZE;
+    int count = (start + PENDULUM_CHUNK_SIZE <= ensemble->count)? PENDULUM_CHUNK_SIZE : ensemble->count - start;
+
+    // Keep the end points before the update, the trail goes from them to the new ones
+    float previousX[PENDULUM_CHUNK_SIZE];
+    float previousY[PENDULUM_CHUNK_SIZE];
+    for (int i = 0; i < count; i++)
+    {
+        previousX[i] = ensemble->endX[start + i];
+        previousY[i] = ensemble->endY[start + i];
+    }
+
+    pendulumJobs->kernel(ensemble, pendulumJobs->params, start, count, pendulumJobs->step, ENSEMBLE_STEPS);
+
+    for (int i = 0; i < count; i++)
+    {
+        float x0 = previousX[i], y0 = previousY[i];
+        float x1 = ensemble->endX[start + i], y1 = ensemble->endY[start + i];
+        float dx = x1 - x0, dy = y1 - y0;
+        float length = sqrtf(dx*dx + dy*dy);
+        float scale = (length > 0.0f)? TRAIL_THICK/(2.0f*length) : 0.0f;
+        float ox = -dy*scale, oy = dx*scale;
+
+        float *v = ensemble->trails.vertices + (start + i)*6*3;
+        v[0] = x0 + ox; v[1] = y0 + oy; v[2] = 0.0f;
+        v[3] = x1 + ox; v[4] = y1 + oy; v[5] = 0.0f;
+        v[6] = x1 - ox; v[7] = y1 - oy; v[8] = 0.0f;
+        v[9] = x0 + ox; v[10] = y0 + oy; v[11] = 0.0f;
+        v[12] = x1 - ox; v[13] = y1 - oy; v[14] = 0.0f;
+        v[15] = x0 - ox; v[16] = y0 - oy; v[17] = 0.0f;
+    }
+}
+
+// Update the ensemble, one job per chunk of pendulums, and upload the trails mesh
+static void UpdatePendulumEnsemble(PendulumEnsemble *ensemble, const PendulumParams *params, PendulumKernel kernel, float step, bool threaded)
+{
+    PendulumJobs pendulumJobs = { ensemble, params, kernel, step };
+
+    RunJobs(UpdatePendulumChunk, &pendulumJobs, (ensemble->count + PENDULUM_CHUNK_SIZE - 1)/PENDULUM_CHUNK_SIZE, threaded);
+
+    UpdateMeshBuffer(ensemble->trails, 0, ensemble->trails.vertices, ensemble->count*6*3*sizeof(float), 0);
+    ensemble->trails.vertexCount = ensemble->count*6;
+    ensemble->trails.triangleCount = ensemble->count*2;
+}
+
+// Take jobs of the current batch until there are none left
+static void RunWorkerJobs(void)
+{
+    int job = 0;
+    while ((job = atomic_fetch_add(&jobs.nextJob, 1)) < jobs.jobCount) jobs.func(jobs.data, job);
+}
+
+// Worker thread, runs jobs of every batch
+static void *JobWorkerThread(void *arg)
+{
+    (void)arg;
+    unsigned int lastBatch = 0;
+
+    pthread_mutex_lock(&jobs.mutex);
+    while (true)
+    {
+        while (!jobs.quit && (jobs.batch == lastBatch)) pthread_cond_wait(&jobs.batchStarted, &jobs.mutex);
+        if (jobs.quit) break;
+
+        lastBatch = jobs.batch;
+        pthread_mutex_unlock(&jobs.mutex);
+
+        RunWorkerJobs();
+
+        pthread_mutex_lock(&jobs.mutex);
+        jobs.pending--;
+        if (jobs.pending == 0) pthread_cond_signal(&jobs.batchDone);
+    }
+    pthread_mutex_unlock(&jobs.mutex);
+
+    return NULL;
+}
+
+// Start the job system worker threads, the calling thread is worker 0
+static void StartJobSystem(int workerCount)
+{
+    if (workerCount < 1) workerCount = 1;
+
+    pthread_mutex_init(&jobs.mutex, NULL);
+    pthread_cond_init(&jobs.batchStarted, NULL);
+    pthread_cond_init(&jobs.batchDone, NULL);
+
+    jobs.workerCount = 1;
+    for (int i = 1; i < workerCount; i++)
+    {
+        if (pthread_create(&jobs.threads[i], NULL, JobWorkerThread, NULL) != 0) break;
+        jobs.workerCount++;
+    }
+
+    TraceLog(LOG_INFO, "PENDULUM: Job system started with %i workers", jobs.workerCount);
+}
+
+// Stop and join the job system worker threads
+static void StopJobSystem(void)
+{
+    pthread_mutex_lock(&jobs.mutex);
+    jobs.quit = true;
+    pthread_cond_broadcast(&jobs.batchStarted);
+    pthread_mutex_unlock(&jobs.mutex);
+
+    for (int i = 1; i < jobs.workerCount; i++) pthread_join(jobs.threads[i], NULL);
+
+    pthread_mutex_destroy(&jobs.mutex);
+    pthread_cond_destroy(&jobs.batchStarted);
+    pthread_cond_destroy(&jobs.batchDone);
+}
+
+// Run jobs [0, jobCount) and wait for all of them, on the calling thread only if not threaded
+static void RunJobs(JobFunc func, void *data, int jobCount, bool threaded)
+{
+    jobs.func = func;
+    jobs.data = data;
+    jobs.jobCount = jobCount;
+    atomic_store(&jobs.nextJob, 0);
+
+    if (!threaded || (jobs.workerCount == 1))
+    {
+        RunWorkerJobs();
+        return;
+    }
+
+    pthread_mutex_lock(&jobs.mutex);
+    jobs.pending = jobs.workerCount - 1;
+    jobs.batch++;
+    pthread_cond_broadcast(&jobs.batchStarted);
+    pthread_mutex_unlock(&jobs.mutex);
+
+    RunWorkerJobs();
+
+    pthread_mutex_lock(&jobs.mutex);
+    while (jobs.pending > 0) pthread_cond_wait(&jobs.batchDone, &jobs.mutex);
+    pthread_mutex_unlock(&jobs.mutex);
+}
@@ -20,12 +20,73 @@
 #include "rlgl.h"
 
 #include <math.h>
+#include <string.h>         // Required for: memcpy()
+
+#define MAX_ROUNDED_SEGMENTS    64      // Max segments of a rounded corner, unit arcs are cached up to this count
+#define SHAPE_CACHE_SIZE        256     // Rounded rectangle shapes kept in the cache
+#define SHAPE_CACHE_PROBES      8       // Cache slots checked for a shape before replacing one
+
+#define BENCHMARK_RECTANGLES    10000   // Rectangles drawn per frame on benchmark mode
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Rounded rectangle with horizontal gradient, batched draw input
+typedef struct RoundedGradientRec {
+    Rectangle rec;
+    float roundnessLeft;
+    float roundnessRight;
+    int segments;
+    Color left;
+    Color right;
+} RoundedGradientRec;
+
+// Rounded rectangle shape vertex, relative to the rectangle origin
+typedef struct ShapeVertex {
+    Vector2 position;
+    bool right;             // Vertex takes the right color, otherwise the left one
+} ShapeVertex;
+
+// Rounded rectangle shape triangles, cached by size, roundness and segments
+// NOTE: Colors and position are not part of the shape, they are applied when the shape is drawn
+typedef struct RoundedShape {
+    float width;
+    float height;
+    float roundnessLeft;
+    float roundnessRight;
+    int segments;
+    ShapeVertex *vertices;
+    int vertexCount;
+} RoundedShape;
+
+// Rounded rectangles draw method
+typedef enum {
+    DRAW_DIRECT = 0,        // Corner arcs computed on every call
+    DRAW_CACHED,            // Cached shape, one rlBegin()/rlEnd() per rectangle
+    DRAW_BATCHED,           // Cached shapes, all rectangles in one rlBegin()/rlEnd()
+    DRAW_METHOD_COUNT
+} DrawMethod;
 
 //--------------------------------------------------------------------------------------
 // Module Functions Declaration
 //--------------------------------------------------------------------------------------
 // Draw rectangle with rounded edges and horizontal gradient, with options to choose side of roundness
 static void DrawRectangleRoundedGradientH(Rectangle rec, float roundnessLeft, float roundnessRight, int segments, Color left, Color right);
+// Draw many rectangles with rounded edges and horizontal gradient in a single vertex stream
+static void DrawRectangleRoundedGradientHBatch(const RoundedGradientRec *recs, int count);
+// Draw rectangle with rounded edges and horizontal gradient, corner arcs computed on every call
+static void DrawRectangleRoundedGradientHDirect(Rectangle rec, float roundnessLeft, float roundnessRight, int segments, Color left, Color right);
+// Get the cached shape of a rounded rectangle, built if not found
+static const RoundedShape *GetRoundedShape(float width, float height, float roundnessLeft, float roundnessRight, int segments);
+// Unload the rounded shapes cache and the unit arcs
+static void UnloadRoundedShapeCache(void);
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static Vector2 *unitArcs[MAX_ROUNDED_SEGMENTS + 1] = { 0 };    // Unit circle points every 90/segments degrees
+static RoundedShape shapeCache[SHAPE_CACHE_SIZE] = { 0 };
+static int shapesBuilt = 0;             // Shapes built since the start, cache misses
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -39,6 +100,29 @@ int main(void)
 
     InitWindow(screenWidth, screenHeight, "raylib [shapes] example - rectangle advanced");
 
+    // Benchmark rectangles, UI like sizes so most of them share a few cached shapes
+    const float widths[4] = { 40.0f, 64.0f, 96.0f, 128.0f };
+    const float heights[3] = { 16.0f, 24.0f, 32.0f };
+    const Color colors[6] = { BLUE, RED, PINK, BLACK, GOLD, DARKGREEN };
+
+    RoundedGradientRec *benchmarkRecs = (RoundedGradientRec *)RL_CALLOC(BENCHMARK_RECTANGLES, sizeof(RoundedGradientRec));
+    for (int i = 0; i < BENCHMARK_RECTANGLES; i++)
+    {
+        float width = widths[GetRandomValue(0, 3)];
+        float height = heights[GetRandomValue(0, 2)];
+
+        benchmarkRecs[i].rec = (Rectangle){ (float)GetRandomValue(0, screenWidth - (int)width), (float)GetRandomValue(0, screenHeight - (int)height), width, height };
+        benchmarkRecs[i].roundnessLeft = GetRandomValue(0, 1)? 1.0f : 0.5f;
+        benchmarkRecs[i].roundnessRight = GetRandomValue(0, 1)? 1.0f : 0.5f;
+        benchmarkRecs[i].segments = 8;
+        benchmarkRecs[i].left = colors[GetRandomValue(0, 5)];
+        benchmarkRecs[i].right = colors[GetRandomValue(0, 5)];
+    }
+
+    bool benchmark = false;
+    int drawMethod = DRAW_BATCHED;
+    float drawTime[DRAW_METHOD_COUNT] = { 0 };  // Benchmark draw time of every method, averaged (ms)
+
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
 
@@ -53,6 +137,9 @@ int main(void)
             GetScreenHeight()/2.0f - 5*(height/2),
             width, height
         };
+
+        if (IsKeyPressed(KEY_SPACE)) benchmark = !benchmark;
+        if (IsKeyPressed(KEY_M)) drawMethod = (drawMethod + 1)%DRAW_METHOD_COUNT;
         //--------------------------------------------------------------------------------------
 
         // Draw
@@ -60,26 +147,64 @@ int main(void)
         BeginDrawing();
             ClearBackground(RAYWHITE);
 
-            // Draw All Rectangles with different roundess  for each side and different gradients
-            DrawRectangleRoundedGradientH(rec, 0.8f, 0.8f, 36, BLUE, RED);
+            if (benchmark)
+            {
+                // Time includes sending the vertices to the GPU, the batch is drawn before stopping the timer
+                double drawStartTime = GetTime();
+
+                if (drawMethod == DRAW_BATCHED) DrawRectangleRoundedGradientHBatch(benchmarkRecs, BENCHMARK_RECTANGLES);
+                else
+                {
+                    for (int i = 0; i < BENCHMARK_RECTANGLES; i++)
+                    {
+                        const RoundedGradientRec *r = &benchmarkRecs[i];
+                        if (drawMethod == DRAW_CACHED) DrawRectangleRoundedGradientH(r->rec, r->roundnessLeft, r->roundnessRight, r->segments, r->left, r->right);
+                        else DrawRectangleRoundedGradientHDirect(r->rec, r->roundnessLeft, r->roundnessRight, r->segments, r->left, r->right);
+                    }
+                }
+
+                rlDrawRenderBatchActive();
+                drawTime[drawMethod] = drawTime[drawMethod]*0.95f + (float)(GetTime() - drawStartTime)*1000.0f*0.05f;
+
+                const char *methodNames[DRAW_METHOD_COUNT] = { "Direct (trig per call)", "Cached shapes", "Cached shapes, batched" };
+
+                DrawRectangle(10, 10, 260, 95, Fade(BLACK, 0.8f));
+                DrawText(TextFormat("%i rectangles, (M) %s", BENCHMARK_RECTANGLES, methodNames[drawMethod]), 20, 20, 10, GREEN);
+                for (int m = 0; m < DRAW_METHOD_COUNT; m++)
+                {
+                    DrawText(TextFormat("%s: %.2f ms", methodNames[m], drawTime[m]), 20, 40 + 15*m, 10, (m == drawMethod)? GREEN : LIGHTGRAY);
+                }
+                DrawText(TextFormat("Shapes built: %i", shapesBuilt), 20, 85, 10, LIGHTGRAY);
+                DrawFPS(screenWidth - 90, 10);
+            }
+            else
+            {
+                // Draw All Rectangles with different roundess  for each side and different gradients
+                DrawRectangleRoundedGradientH(rec, 0.8f, 0.8f, 36, BLUE, RED);
 
-            rec.y += rec.height + 1;
-            DrawRectangleRoundedGradientH(rec, 0.5f, 1.0f, 36, RED, PINK);
+                rec.y += rec.height + 1;
+                DrawRectangleRoundedGradientH(rec, 0.5f, 1.0f, 36, RED, PINK);
 
-            rec.y += rec.height + 1;
-            DrawRectangleRoundedGradientH(rec, 1.0f, 0.5f, 36, RED, BLUE);
+                rec.y += rec.height + 1;
+                DrawRectangleRoundedGradientH(rec, 1.0f, 0.5f, 36, RED, BLUE);
 
-            rec.y += rec.height + 1;
-            DrawRectangleRoundedGradientH(rec, 0.0f, 1.0f, 36, BLUE, BLACK);
+                rec.y += rec.height + 1;
+                DrawRectangleRoundedGradientH(rec, 0.0f, 1.0f, 36, BLUE, BLACK);
 
-            rec.y += rec.height + 1;
-            DrawRectangleRoundedGradientH(rec, 1.0f, 0.0f, 36, BLUE, PINK);
+                rec.y += rec.height + 1;
+                DrawRectangleRoundedGradientH(rec, 1.0f, 0.0f, 36, BLUE, PINK);
+
+                DrawText("(SPACE) Benchmark", 10, 10, 10, DARKGRAY);
+            }
         EndDrawing();
         //--------------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    RL_FREE(benchmarkRecs);
+    UnloadRoundedShapeCache();
+
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
@@ -90,8 +215,204 @@ int main(void)
 // Module Functions Definition
 //--------------------------------------------------------------------------------------
 // Draw rectangle with rounded edges and horizontal gradient, with options to choose side of roundness
-// NOTE: Adapted from both 'DrawRectangleRounded()' and 'DrawRectangleGradientH()' raylib [rshapes] implementations
+// NOTE: The shape triangles come from the cache, only the rectangle position and colors are applied
 static void DrawRectangleRoundedGradientH(Rectangle rec, float roundnessLeft, float roundnessRight, int segments, Color left, Color right)
+{
+    const RoundedShape *shape = GetRoundedShape(rec.width, rec.height, roundnessLeft, roundnessRight, segments);
+
+    rlBegin(RL_TRIANGLES);
+        for (int i = 0; i < shape->vertexCount; i++)
+        {
+            Color color = shape->vertices[i].right? right : left;
+            rlColor4ub(color.r, color.g, color.b, color.a);
+            rlVertex2f(rec.x + shape->vertices[i].position.x, rec.y + shape->vertices[i].position.y);
+        }
+    rlEnd();
+}
+
+// Draw many rectangles with rounded edges and horizontal gradient in a single vertex stream
+// NOTE: All the triangles are added to the render batch between one rlBegin()/rlEnd(),
+// the batch is only drawn when it gets full
+static void DrawRectangleRoundedGradientHBatch(const RoundedGradientRec *recs, int count)
+{
+    rlBegin(RL_TRIANGLES);
+        for (int r = 0; r < count; r++)
+        {
+            const RoundedGradientRec *rec = &recs[r];
+            const RoundedShape *shape = GetRoundedShape(rec->rec.width, rec->rec.height, rec->roundnessLeft, rec->roundnessRight, rec->segments);
+
+            for (int i = 0; i < shape->vertexCount; i++)
+            {
+                Color color = shape->vertices[i].right? rec->right : rec->left;
+                rlColor4ub(color.r, color.g, color.b, color.a);
+                rlVertex2f(rec->rec.x + shape->vertices[i].position.x, rec->rec.y + shape->vertices[i].position.y);
+            }
+        }
+    rlEnd();
+}
+
+// Get the unit circle points every 90/segments degrees, computed the first time they are needed
+// NOTE: The 4*segments + 1 points cover the full circle, every corner uses a quarter of them
+static const Vector2 *GetUnitArc(int segments)
+{
+    if (unitArcs[segments] == NULL)
+    {
+        unitArcs[segments] = (Vector2 *)RL_CALLOC(4*segments + 1, sizeof(Vector2));
+
+        float stepLength = 90.0f/(float)segments;
+        for (int i = 0; i <= 4*segments; i++) unitArcs[segments][i] = (Vector2){ cosf(DEG2RAD*stepLength*i), sinf(DEG2RAD*stepLength*i) };
+    }
+
+    return unitArcs[segments];
+}
+
+// Add a vertex to a shape being built
+static void AddShapeVertex(RoundedShape *shape, Vector2 position, bool right)
+{
+    shape->vertices[shape->vertexCount].position = position;
+    shape->vertices[shape->vertexCount].right = right;
+    shape->vertexCount++;
+}
+
+// Build the triangles of a rounded rectangle at the origin
+// NOTE: Same triangles as DrawRectangleRoundedGradientHDirect(), with the corner arcs taken from the unit arcs
+static void BuildRoundedShape(RoundedShape *shape)
+{
+    float width = shape->width;
+    float height = shape->height;
+    int segments = shape->segments;
+
+    shape->vertices = (ShapeVertex *)RL_CALLOC(12*segments + 30, sizeof(ShapeVertex));
+    shape->vertexCount = 0;
+
+    // Neither side is rounded, a plain gradient rectangle
+    if ((shape->roundnessLeft <= 0.0f) && (shape->roundnessRight <= 0.0f))
+    {
+        AddShapeVertex(shape, (Vector2){ 0, 0 }, false);
+        AddShapeVertex(shape, (Vector2){ 0, height }, false);
+        AddShapeVertex(shape, (Vector2){ width, height }, true);
+        AddShapeVertex(shape, (Vector2){ 0, 0 }, false);
+        AddShapeVertex(shape, (Vector2){ width, height }, true);
+        AddShapeVertex(shape, (Vector2){ width, 0 }, true);
+        return;
+    }
+
+    // Calculate corner radius both from right and left
+    float recSize = (width > height)? height : width;
+    float radiusLeft = (recSize*shape->roundnessLeft)/2;
+    float radiusRight = (recSize*shape->roundnessRight)/2;
+
+    // Points of the 'DrawRectangleRounded()' diagram, see DrawRectangleRoundedGradientHDirect()
+    const Vector2 point[12] = {
+        { radiusLeft, 0 }, { width - radiusRight, 0 }, { width, radiusRight },
+        { width, height - radiusRight }, { width - radiusRight, height },
+        { radiusLeft, height }, { 0, height - radiusLeft }, { 0, radiusLeft },
+        { radiusLeft, radiusLeft }, { width - radiusRight, radiusRight },
+        { width - radiusRight, height - radiusRight }, { radiusLeft, height - radiusLeft }
+    };
+
+    // Corners: [1] Upper Left, [3] Upper Right, [5] Lower Right, [7] Lower Left, starting at 180, 270, 0 and 90 degrees
+    const Vector2 *arc = GetUnitArc(segments);
+    const int arcStart[4] = { 2*segments, 3*segments, 0, segments };
+    const bool cornerRight[4] = { false, true, true, false };
+
+    for (int k = 0; k < 4; k++)
+    {
+        Vector2 center = point[8 + k];
+        float radius = cornerRight[k]? radiusRight : radiusLeft;
+
+        for (int i = arcStart[k]; i < arcStart[k] + segments; i++)
+        {
+            AddShapeVertex(shape, center, cornerRight[k]);
+            AddShapeVertex(shape, (Vector2){ center.x + arc[i + 1].x*radius, center.y + arc[i + 1].y*radius }, cornerRight[k]);
+            AddShapeVertex(shape, (Vector2){ center.x + arc[i].x*radius, center.y + arc[i].y*radius }, cornerRight[k]);
+        }
+    }
+
+    // Rectangles [2] Upper, [4] Right, [6] Bottom, [8] Left and [9] Middle, two triangles each
+    const int quads[5][6] = {
+        { 0, 8, 9, 1, 0, 9 }, { 9, 10, 3, 2, 9, 3 }, { 11, 5, 4, 10, 11, 4 }, { 7, 6, 11, 8, 7, 11 }, { 8, 11, 10, 9, 8, 10 }
+    };
+    const bool quadRight[5][6] = {
+        { false, false, true, true, false, true }, { true, true, true, true, true, true }, { false, false, true, true, false, true },
+        { false, false, false, false, false, false }, { false, false, true, true, false, true }
+    };
+
+    for (int q = 0; q < 5; q++)
+    {
+        for (int v = 0; v < 6; v++) AddShapeVertex(shape, point[quads[q][v]], quadRight[q][v]);
+    }
+}
+
+// Get the cached shape of a rounded rectangle, built if not found
+// NOTE: Shapes are found by hash with a few probes, a full probe range replaces the first slot
+static const RoundedShape *GetRoundedShape(float width, float height, float roundnessLeft, float roundnessRight, int segments)
+{
+    // Same limits as DrawRectangleRoundedGradientHDirect(), so equivalent shapes share the cache entry
+    if (roundnessLeft >= 1.0f) roundnessLeft = 1.0f;
+    if (roundnessRight >= 1.0f) roundnessRight = 1.0f;
+    if (roundnessLeft <= 0.0f) roundnessLeft = 0.0f;
+    if (roundnessRight <= 0.0f) roundnessRight = 0.0f;
+    if ((width < 1) || (height < 1)) roundnessLeft = roundnessRight = 0.0f;
+    if (segments < 1) segments = 1;
+    if (segments > MAX_ROUNDED_SEGMENTS) segments = MAX_ROUNDED_SEGMENTS;
+
+    unsigned int key[5] = { 0 };
+    memcpy(&key[0], &width, sizeof(float));
+    memcpy(&key[1], &height, sizeof(float));
+    memcpy(&key[2], &roundnessLeft, sizeof(float));
+    memcpy(&key[3], &roundnessRight, sizeof(float));
+    key[4] = (unsigned int)segments;
+
+    unsigned int hash = 2166136261u;
+    for (int i = 0; i < 5; i++) hash = (hash ^ key[i])*16777619u;
+
+    int slot = -1;
+    for (int p = 0; p < SHAPE_CACHE_PROBES; p++)
+    {
+        RoundedShape *shape = &shapeCache[(hash + p)%SHAPE_CACHE_SIZE];
+
+        if (shape->vertices == NULL)
+        {
+            if (slot < 0) slot = (hash + p)%SHAPE_CACHE_SIZE;
+            continue;
+        }
+
+        if ((shape->width == width) && (shape->height == height) && (shape->roundnessLeft == roundnessLeft) &&
+            (shape->roundnessRight == roundnessRight) && (shape->segments == segments)) return shape;
+    }
+
+    if (slot < 0) slot = hash%SHAPE_CACHE_SIZE;
+
+    RoundedShape *shape = &shapeCache[slot];
+    RL_FREE(shape->vertices);
+    *shape = (RoundedShape){ width, height, roundnessLeft, roundnessRight, segments, NULL, 0 };
+    BuildRoundedShape(shape);
+    shapesBuilt++;
+
+    return shape;
+}
+
+// Unload the rounded shapes cache and the unit arcs
+static void UnloadRoundedShapeCache(void)
+{
+    for (int i = 0; i < SHAPE_CACHE_SIZE; i++)
+    {
+        RL_FREE(shapeCache[i].vertices);
+        shapeCache[i] = (RoundedShape){ 0 };
+    }
+
+    for (int i = 0; i <= MAX_ROUNDED_SEGMENTS; i++)
+    {
+        RL_FREE(unitArcs[i]);
+        unitArcs[i] = NULL;
+    }
+}
+
+// Draw rectangle with rounded edges and horizontal gradient, corner arcs computed on every call
+// NOTE: Adapted from both 'DrawRectangleRounded()' and 'DrawRectangleGradientH()' raylib [rshapes] implementations,
+// kept as reference for the benchmark and to build the cached shapes with the same triangles
+static void DrawRectangleRoundedGradientHDirect(Rectangle rec, float roundnessLeft, float roundnessRight, int segments, Color left, Color right)
 {
     // Neither side is rounded
     if ((roundnessLeft <= 0.0f && roundnessRight <= 0.0f) || (rec.width < 1) || (rec.height < 1 ))
@@ -148,128 +469,6 @@ static void DrawRectangleRoundedGradientH(Rectangle rec, float roundnessLeft, fl
     const Vector2 centers[4] = { point[8], point[9], point[10], point[11] };
     const float angles[4] = { 180.0f, 270.0f, 0.0f, 90.0f };
 
-#if defined(SUPPORT_QUADS_DRAW_MODE)
-    rlSetTexture(GetShapesTexture().id);
-    Rectangle shapeRect = GetShapesTextureRectangle();
-
-    rlBegin(RL_QUADS);
-        // Draw all the 4 corners: [1] Upper Left Corner, [3] Upper Right Corner, [5] Lower Right Corner, [7] Lower Left Corner
-        for (int k = 0; k < 4; ++k)
-        {
-            Color color;
-            float radius;
-            if (k == 0) color = left,  radius = radiusLeft;     // [1] Upper Left Corner
-            if (k == 1) color = right, radius = radiusRight;    // [3] Upper Right Corner
-            if (k == 2) color = right, radius = radiusRight;    // [5] Lower Right Corner
-            if (k == 3) color = left,  radius = radiusLeft;     // [7] Lower Left Corner
-            float angle = angles[k];
-            const Vector2 center = centers[k];
-
-            for (int i = 0; i < segments/2; i++)
-            {
-                rlColor4ub(color.r, color.g, color.b, color.a);
-                rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength*2))*radius, center.y + sinf(DEG2RAD*(angle + stepLength*2))*radius);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-                rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                angle += (stepLength*2);
-            }
-
-            // End one even segments
-            if ( segments % 2)
-            {
-                rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*(angle + stepLength))*radius, center.y + sinf(DEG2RAD*(angle + stepLength))*radius);
-
-                rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-                rlVertex2f(center.x + cosf(DEG2RAD*angle)*radius, center.y + sinf(DEG2RAD*angle)*radius);
-
-                rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-                rlVertex2f(center.x, center.y);
-            }
-        }
-
-        // Here we use the 'Diagram' to guide ourselves to which point receives what color
-        // By choosing the color correctly associated with a pointe the gradient effect
-        // will naturally come from OpenGL interpolation
-
-        // [2] Upper Rectangle
-        rlColor4ub(left.r, left.g, left.b, left.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[0].x, point[0].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-
-        rlColor4ub(right.r, right.g, right.b, right.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-
-        rlColor4ub(right.r, right.g, right.b, right.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[1].x, point[1].y);
-
-        // [4] Left Rectangle
-        rlColor4ub(right.r, right.g, right.b, right.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[2].x, point[2].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[3].x, point[3].y);
-
-        // [6] Bottom Rectangle
-        rlColor4ub(left.r, left.g, left.b, left.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[5].x, point[5].y);
-
-        rlColor4ub(right.r, right.g, right.b, right.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[4].x, point[4].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-
-        // [8] left Rectangle
-        rlColor4ub(left.r, left.g, left.b, left.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[7].x, point[7].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[6].x, point[6].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-
-        // [9] Middle Rectangle
-        rlColor4ub(left.r, left.g, left.b, left.a);
-        rlTexCoord2f(shapeRect.x/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[8].x, point[8].y);
-        rlTexCoord2f(shapeRect.x/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[11].x, point[11].y);
-
-        rlColor4ub(right.r, right.g, right.b, right.a);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, (shapeRect.y + shapeRect.height)/texShapes.height);
-        rlVertex2f(point[10].x, point[10].y);
-        rlTexCoord2f((shapeRect.x + shapeRect.width)/texShapes.width, shapeRect.y/texShapes.height);
-        rlVertex2f(point[9].x, point[9].y);
-
-    rlEnd();
-    rlSetTexture(0);
-#else
 
     // Here we use the 'Diagram' to guide ourselves to which point receives what color
     // By choosing the color correctly associated with a pointe the gradient effect
@@ -354,5 +553,4 @@ static void DrawRectangleRoundedGradientH(Rectangle rec, float roundnessLeft, fl
         rlColor4ub(right.r, right.g, right.b, right.a);
         rlVertex2f(point[10].x, point[10].y);
     rlEnd();
-#endif
 }
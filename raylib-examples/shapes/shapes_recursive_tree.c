@@ -16,20 +16,52 @@
 ********************************************************************************************/
 
 #include "raylib.h"
-#include <math.h>
+#include "raymath.h"                // Required for: MatrixIdentity()
+#include "rlgl.h"                   // Required for: rlDisableBackfaceCulling(), rlEnableBackfaceCulling()
+
+#include <math.h>                   // Required for: sinf(), cosf(), sqrtf(), floorf()
 
 #define RAYGUI_IMPLEMENTATION
 #include "raygui.h"                 // Required for GUI controls
 
+#define MAX_TREE_DEPTH      20          // Branch levels, the last one has 2^(depth - 1) branches
+#define MAX_TREE_SEGMENTS   (1 << 21)   // Line segments the tree mesh can hold
+#define BEZIER_SEGMENTS     24          // Line segments of a bezier branch, same divisions as DrawLineBezier()
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-typedef struct {
+// Tree mesh, the branches line segments as quads of two triangles
+// NOTE: The mesh is only generated again when a tree parameter changes,
+// its buffers grow as needed and are reused by smaller trees
+typedef struct TreeMesh {
+    Mesh mesh;
+    int capacity;               // Line segments the mesh buffers can hold
+    int segments;               // Line segments of the current tree
+
+    // Parameters of the current tree
     Vector2 start;
-    Vector2 end;
     float angle;
     float length;
-} Branch;
+    float decay;
+    float thick;
+    int depth;
+    bool bezier;
+
+    int levels;                 // Generated branch levels, depth is reduced to fit the tree
+} TreeMesh;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+// Generate the tree mesh if any parameter changed, returns true if it was generated
+static bool GenTreeMesh(TreeMesh *tree, Vector2 start, float angle, float length, float decay, float thick, int depth, bool bezier);
+// Add a branch and its children to the tree mesh
+static void GenTreeBranch(TreeMesh *tree, Vector2 start, Vector2 direction, float length, int level, float cosTheta, float sinTheta);
+// Add a line segment to the tree mesh
+static void AddTreeSegment(TreeMesh *tree, Vector2 start, Vector2 end);
+// Unload the tree mesh
+static void UnloadTreeMesh(TreeMesh *tree);
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -45,12 +77,19 @@ int main(void)
 
     Vector2 start = { (screenWidth/2.0f) - 125.0f, (float)screenHeight };
     float angle = 40.0f;
-    float thick = 1.0f;   
+    float thick = 1.0f;
     float treeDepth = 10.0f;
     float branchDecay = 0.66f;
     float length = 120.0f;
     bool bezier = false;
 
+    TreeMesh tree = { 0 };
+    double buildTime = 0.0;         // Time of the last tree generation (ms)
+
+    // The whole tree is drawn in a single call with the default material
+    Material material = LoadMaterialDefault();
+    material.maps[MATERIAL_MAP_DIFFUSE].color = RED;
+
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
 
@@ -59,50 +98,20 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
-        float theta = angle*DEG2RAD;
-        int maxBranches = (int)(powf(2, floorf(treeDepth)));
-        Branch branches[1030] = { 0 };
-        int count = 0;
-
-        Vector2 initialEnd = { start.x + length*sinf(0.0f), start.y - length*cosf(0.0f) };
-        branches[count++] = (Branch){start, initialEnd, 0.0f, length};
-
-        for (int i = 0; i < count; i++) 
-        {
-            Branch branch = branches[i];
-            if (branch.length < 2) continue;
-
-            float nextLength = branch.length*branchDecay;
-
-            if (count < maxBranches && nextLength >= 2) 
-            {
-                Vector2 branchStart = branch.end;
-
-                float angle1 = branch.angle + theta;
-                Vector2 branchEnd1 = { branchStart.x + nextLength*sinf(angle1), branchStart.y - nextLength*cosf(angle1) };
-                branches[count++] = (Branch){branchStart, branchEnd1, angle1, nextLength};
-                
-                float angle2 = branch.angle - theta;
-                Vector2 branchEnd2 = { branchStart.x + nextLength*sinf(angle2), branchStart.y - nextLength*cosf(angle2) };
-                branches[count++] = (Branch){branchStart, branchEnd2, angle2, nextLength};
-            }
-        }
+        double buildStartTime = GetTime();
+        if (GenTreeMesh(&tree, start, angle, length, branchDecay, thick, (int)floorf(treeDepth), bezier)) buildTime = (GetTime() - buildStartTime)*1000.0;
         //----------------------------------------------------------------------------------
+
         // Draw
         //----------------------------------------------------------------------------------
         BeginDrawing();
 
             ClearBackground(RAYWHITE);
 
-            for (int i = 0; i < count; i++) 
-            {
-                Branch branch = branches[i];
-                if (branch.length >= 2) 
-                {
-                    if (bezier) DrawLineBezier(branch.start, branch.end, thick, RED);
-                    else DrawLineEx(branch.start, branch.end, thick, RED);
-                }
-            }
+            // Segments are oriented in any direction, draw both faces
+            rlDisableBackfaceCulling();
+            if (tree.segments > 0) DrawMesh(tree.mesh, material, MatrixIdentity());
+            rlEnableBackfaceCulling();
 
             DrawLine(580, 0, 580, GetScreenHeight(), (Color){ 218, 218, 218, 255 });
             DrawRectangle(580, 0, GetScreenWidth(), GetScreenHeight(), (Color){ 232, 232, 232, 255 });
@@ -112,11 +121,14 @@ int main(void)
             GuiSliderBar((Rectangle){ 640, 40, 120, 20}, "Angle", TextFormat("%.0f", angle), &angle, 0, 180);
             GuiSliderBar((Rectangle){ 640, 70, 120, 20 }, "Length", TextFormat("%.0f", length), &length, 12.0f, 240.0f);
             GuiSliderBar((Rectangle){ 640, 100, 120, 20}, "Decay", TextFormat("%.2f", branchDecay), &branchDecay, 0.1f, 0.78f);
-            GuiSliderBar((Rectangle){ 640, 130, 120, 20 }, "Depth", TextFormat("%.0f", treeDepth), &treeDepth, 1.0f, 10.f);
+            GuiSliderBar((Rectangle){ 640, 130, 120, 20 }, "Depth", TextFormat("%.0f", treeDepth), &treeDepth, 1.0f, (float)MAX_TREE_DEPTH);
             GuiSliderBar((Rectangle){ 640, 160, 120, 20}, "Thick", TextFormat("%.0f", thick), &thick, 1, 8);
             GuiCheckBox((Rectangle){ 640, 190, 20, 20 }, "Bezier", &bezier);
             //------------------------------------------------------------------------------
 
+            DrawText(TextFormat("Segments: %i", tree.segments), 600, 230, 10, DARKGRAY);
+            DrawText(TextFormat("Last build: %.2f ms", buildTime), 600, 245, 10, DARKGRAY);
+
             DrawFPS(10, 10);
 
         EndDrawing();
@@ -125,8 +137,133 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    UnloadTreeMesh(&tree);
+    UnloadMaterial(material);
+
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
     return 0;
-}
\ No newline at end of file
+}
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Generate the tree mesh if any parameter changed, returns true if it was generated
+// NOTE: Levels are only generated complete, the depth is reduced while the tree does not fit
+static bool GenTreeMesh(TreeMesh *tree, Vector2 start, float angle, float length, float decay, float thick, int depth, bool bezier)
+{
+    if ((tree->capacity > 0) && (start.x == tree->start.x) && (start.y == tree->start.y) && (angle == tree->angle) &&
+        (length == tree->length) && (decay == tree->decay) && (thick == tree->thick) && (depth == tree->depth) && (bezier == tree->bezier)) return false;
+
+    tree->start = start;
+    tree->angle = angle;
+    tree->length = length;
+    tree->decay = decay;
+    tree->thick = thick;
+    tree->depth = depth;
+    tree->bezier = bezier;
+
+    int branchSegments = bezier? BEZIER_SEGMENTS : 1;
+    tree->levels = depth;
+    while ((tree->levels > 1) && (((1 << tree->levels) - 1)*branchSegments > MAX_TREE_SEGMENTS)) tree->levels--;
+
+    // Mesh buffers can not be resized, a larger tree needs new ones
+    int required = ((1 << tree->levels) - 1)*branchSegments;
+    bool upload = false;
+
+    if (required > tree->capacity)
+    {
+        if (tree->capacity > 0) UnloadMesh(tree->mesh);
+
+        tree->mesh = (Mesh){ 0 };
+        tree->mesh.vertices = (float *)RL_CALLOC(required*6*3, sizeof(float));
+        tree->capacity = required;
+        upload = true;
+    }
+
+    // Children directions are the parent direction rotated by +/- angle
+    tree->segments = 0;
+    GenTreeBranch(tree, start, (Vector2){ 0.0f, -1.0f }, length, 0, cosf(angle*DEG2RAD), sinf(angle*DEG2RAD));
+
+    if (upload)
+    {
+        tree->mesh.vertexCount = tree->capacity*6;
+        tree->mesh.triangleCount = tree->capacity*2;
+        UploadMesh(&tree->mesh, true);
+    }
+    else if (tree->segments > 0) UpdateMeshBuffer(tree->mesh, 0, tree->mesh.vertices, tree->segments*6*3*sizeof(float), 0);
+
+    // Only the vertices of the current tree are drawn
+    tree->mesh.vertexCount = tree->segments*6;
+    tree->mesh.triangleCount = tree->segments*2;
+
+    return true;
+}
+
+// Add a branch and its children to the tree mesh
+static void GenTreeBranch(TreeMesh *tree, Vector2 start, Vector2 direction, float length, int level, float cosTheta, float sinTheta)
+{
+    if ((level >= tree->levels) || (length < 2.0f)) return;
+
+    Vector2 end = { start.x + direction.x*length, start.y + direction.y*length };
+
+    if (tree->bezier)
+    {
+        // Same curve as DrawLineBezier(), cubic easing in and out on y
+        Vector2 previous = start;
+
+        for (int i = 1; i <= BEZIER_SEGMENTS; i++)
+        {
+            float t = 2.0f*i/BEZIER_SEGMENTS;
+            float ease = (t < 1.0f)? 0.5f*t*t*t : 0.5f*((t - 2.0f)*(t - 2.0f)*(t - 2.0f) + 2.0f);
+            Vector2 current = { start.x + (end.x - start.x)*i/BEZIER_SEGMENTS, start.y + (end.y - start.y)*ease };
+
+            AddTreeSegment(tree, previous, current);
+            previous = current;
+        }
+    }
+    else AddTreeSegment(tree, start, end);
+
+    Vector2 right = { direction.x*cosTheta - direction.y*sinTheta, direction.x*sinTheta + direction.y*cosTheta };
+    Vector2 left = { direction.x*cosTheta + direction.y*sinTheta, -direction.x*sinTheta + direction.y*cosTheta };
+
+    GenTreeBranch(tree, end, right, length*tree->decay, level + 1, cosTheta, sinTheta);
+    GenTreeBranch(tree, end, left, length*tree->decay, level + 1, cosTheta, sinTheta);
+}
+
+// Add a line segment to the tree mesh
+// NOTE: The segment is a quad as wide as the line thickness, like DrawLineEx()
+static void AddTreeSegment(TreeMesh *tree, Vector2 start, Vector2 end)
+{
+    float dx = end.x - start.x;
+    float dy = end.y - start.y;
+    float segmentLength = sqrtf(dx*dx + dy*dy);
+    if (segmentLength == 0.0f) return;
+
+    float scale = tree->thick/(2.0f*segmentLength);
+    Vector2 offset = { -dy*scale, dx*scale };
+
+    Vector2 corners[6] = {
+        { start.x + offset.x, start.y + offset.y }, { end.x + offset.x, end.y + offset.y }, { end.x - offset.x, end.y - offset.y },
+        { start.x + offset.x, start.y + offset.y }, { end.x - offset.x, end.y - offset.y }, { start.x - offset.x, start.y - offset.y }
+    };
+
+    float *vertices = tree->mesh.vertices + tree->segments*6*3;
+    for (int i = 0; i < 6; i++)
+    {
+        vertices[i*3] = corners[i].x;
+        vertices[i*3 + 1] = corners[i].y;
+        vertices[i*3 + 2] = 0.0f;
+    }
+
+    tree->segments++;
+}
+
+// Unload the tree mesh
+static void UnloadTreeMesh(TreeMesh *tree)
+{
+    if (tree->capacity > 0) UnloadMesh(tree->mesh);
+
+    *tree = (TreeMesh){ 0 };
+}
@@ -17,10 +17,62 @@
 
 #include "raylib.h"
 
-#include <stdlib.h>         // Required for: calloc(), free()
+#include "rlgl.h"           // Required for: rlDrawRenderBatchActive()
+
+#include <stdlib.h>         // Required for: calloc(), realloc(), free()
 #include <math.h>           // Required for: cosf(), sinf()
 
-#define MAX_PARTICLES 3000  // Max number of particles
+// Update kernel instruction set, selected at compile time (-mavx enables the 8-wide path)
+#if defined(__AVX__)
+    #include <immintrin.h>  // Required for: AVX intrinsics
+    #define PARTICLE_SIMD_WIDTH 8
+    #define PARTICLE_SIMD_NAME "AVX"
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #include <emmintrin.h>  // Required for: SSE2 intrinsics
+    #define PARTICLE_SIMD_WIDTH 4
+    #define PARTICLE_SIMD_NAME "SSE2"
+#else
+    #define PARTICLE_SIMD_WIDTH 1   // No SIMD instruction set available, particles are integrated one at a time
+    #define PARTICLE_SIMD_NAME "none"
+#endif
+
+// SIMD operations used by the integrator, PARTICLE_SIMD_WIDTH lanes
+#if (PARTICLE_SIMD_WIDTH == 8)
+    #define SIMD_FLOAT __m256
+    #define SIMD_SET(value) _mm256_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm256_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm256_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm256_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm256_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm256_mul_ps(a, b)
+    #define SIMD_OR(a, b) _mm256_or_ps(a, b)
+    #define SIMD_LT(a, b) _mm256_cmp_ps(a, b, _CMP_LT_OQ)
+    #define SIMD_GT(a, b) _mm256_cmp_ps(a, b, _CMP_GT_OQ)
+    #define SIMD_LE(a, b) _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+    #define SIMD_GE(a, b) _mm256_cmp_ps(a, b, _CMP_GE_OQ)
+    #define SIMD_MASK(a) _mm256_movemask_ps(a)
+#elif (PARTICLE_SIMD_WIDTH == 4)
+    #define SIMD_FLOAT __m128
+    #define SIMD_SET(value) _mm_set1_ps(value)
+    #define SIMD_LOAD(ptr) _mm_loadu_ps(ptr)
+    #define SIMD_STORE(ptr, value) _mm_storeu_ps(ptr, value)
+    #define SIMD_ADD(a, b) _mm_add_ps(a, b)
+    #define SIMD_SUB(a, b) _mm_sub_ps(a, b)
+    #define SIMD_MUL(a, b) _mm_mul_ps(a, b)
+    #define SIMD_OR(a, b) _mm_or_ps(a, b)
+    #define SIMD_LT(a, b) _mm_cmplt_ps(a, b)
+    #define SIMD_GT(a, b) _mm_cmpgt_ps(a, b)
+    #define SIMD_LE(a, b) _mm_cmple_ps(a, b)
+    #define SIMD_GE(a, b) _mm_cmpge_ps(a, b)
+    #define SIMD_MASK(a) _mm_movemask_ps(a)
+#endif
+
+#define MAX_PARTICLES 1000000       // Max number of particles of every type
+
+#define PARTICLE_TIME_STEP (1.0f/60.0f) // Simulation step, particles move the same at any frame rate
+#define MAX_STEPS_PER_FRAME 4           // Steps run per frame at most, slow frames drop the rest of the time
+
+#define MAX_EMISSION_RATE 20000     // Max particles emitted per step
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -33,31 +85,53 @@ typedef enum ParticleType {
 
 static const char particleTypeNames[3][10] = { "WATER", "SMOKE", "FIRE" };
 
-typedef struct Particle {
-    ParticleType type;      // Particle type (WATER, SMOKE, FIRE)
-    Vector2 position;       // Particle position on screen
-	Vector2 velocity;       // Particle current speed and direction
-    float radius;           // Particle radius
-    Color color;            // Particle color
-
-    float lifeTime;         // Particle life time
-    bool alive;             // Particle alive: inside screen and life time
-} Particle;
-
-typedef struct CircularBuffer {
-	int head;               // Index for the next write
-	int tail;               // Index for the next read
-	Particle *buffer;       // Particle buffer array
-} CircularBuffer;
+// Particle emitter properties of every particle type
+// NOTE: Particles of a type only differ in their emission values, so a type is integrated
+// with the same values for all its particles and color and radius follow the particle life
+typedef struct ParticleEmitter {
+    float radius;           // Radius on emission
+    float radiusSpeed;      // Radius increment per step (smoke expands, fire shrinks)
+    float minRadius;        // Particle dies once its radius gets this small
+    float speed;            // Max speed on emission (pixels per step)
+    float gravity;          // Vertical velocity increment per step
+    float wobble;           // Horizontal oscillation amplitude (pixels per step)
+    float wobbleSpeed;      // Horizontal oscillation angle increment per step (radians)
+    float lifeTime;         // Particle dies once this old (seconds)
+    Color color;            // Color on emission
+    Color colorFade;        // Color decrement per step
+} ParticleEmitter;
+
+static const ParticleEmitter particleEmitters[3] = {
+    { 5.0f, 0.0f, 0.0f, 2.0f, 0.2f, 0.0f, 0.0f, 1e30f, { 0, 121, 241, 255 }, { 0, 0, 0, 0 } },                             // WATER: BLUE, falls
+    { 7.0f, 0.5f, 0.0f, 2.0f, -0.05f, 0.0f, 0.0f, 62.5f*PARTICLE_TIME_STEP, { 130, 130, 130, 255 }, { 0, 0, 0, 4 } },        // SMOKE: GRAY, rises, expands and fades
+    { 10.0f, -0.15f, 0.02f, 0.2f, -0.05f, 1.0f, 215.0f*PARTICLE_TIME_STEP, 1e30f, { 253, 249, 0, 255 }, { 0, 3, 0, 0 } },   // FIRE: YELLOW, rises, shrinks and reddens
+};
+
+// Particles of one type, structure of arrays with the live particles in [0, count)
+// NOTE: Dead particles are replaced by the last live one (swap-remove), the pool stays dense
+typedef struct ParticlePool {
+    float *positionX;       // Particle position on screen
+    float *positionY;
+    float *velocityX;       // Particle current speed and direction
+    float *velocityY;
+    float *wobbleCos;       // Horizontal oscillation phase, rotated every step
+    float *wobbleSin;
+    float *radius;          // Particle radius
+    float *lifeTime;        // Particle life time
+    int *dead;              // Particles died on the last step
+    int count;              // Live particles
+    int capacity;           // Allocated particles, grows with the pool up to MAX_PARTICLES
+    ParticleType type;
+} ParticlePool;
 
 //----------------------------------------------------------------------------------
 // Module Functions Declaration
 //----------------------------------------------------------------------------------
-static void EmitParticle(CircularBuffer *circularBuffer, Vector2 emitterPosition, ParticleType type);
-static Particle *AddToCircularBuffer(CircularBuffer *circularBuffer);
-static void UpdateParticles(CircularBuffer *circularBuffer, int screenWidth, int screenHeight);
-static void UpdateCircularBuffer(CircularBuffer *circularBuffer);
-static void DrawParticles(CircularBuffer *circularBuffer);
+static ParticlePool LoadParticlePool(ParticleType type);
+static void UnloadParticlePool(ParticlePool *pool);
+static void EmitParticle(ParticlePool *pool, Vector2 emitterPosition);
+static void UpdateParticles(ParticlePool *pool, int screenWidth, int screenHeight);
+static void DrawParticles(const ParticlePool *pool, Texture2D texture);
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -71,14 +145,27 @@ int main(void)
 
     InitWindow(screenWidth, screenHeight, "raylib [shapes] example - simple particles");
 
-    // Definition of particles
-    Particle *particles = (Particle*)RL_CALLOC(MAX_PARTICLES, sizeof(Particle)); // Particle array
-	CircularBuffer circularBuffer = { 0, 0, particles };
+    // Definition of particles, one pool per particle type
+    ParticlePool pools[3] = { LoadParticlePool(WATER), LoadParticlePool(SMOKE), LoadParticlePool(FIRE) };
 
-	// Particle emitter parameters
-    int emissionRate = -2;          // Negative: on average every -X frames. Positive: particles per frame
-	ParticleType currentType = WATER;
-	Vector2 emitterPosition = { screenWidth/2.0f, screenHeight/2.0f };
+    // Particles are drawn as textured quads of a pre-rendered circle
+    // NOTE: This is done to improve the performance, DrawCircle() is too slow for many particles
+    RenderTexture2D particleTexture = LoadRenderTexture(64, 64);
+    BeginTextureMode(particleTexture);
+        ClearBackground(BLANK);
+        DrawCircle(32, 32, 32.0f, WHITE);
+    EndTextureMode();
+    SetTextureFilter(particleTexture.texture, TEXTURE_FILTER_BILINEAR);
+
+    // Particle emitter parameters
+    int emissionRate = -2;          // Negative: on average every -X steps. Positive: particles per step
+    ParticleType currentType = WATER;
+    Vector2 emitterPosition = { screenWidth/2.0f, screenHeight/2.0f };
+
+    // Fixed time step simulation
+    float stepAccumulator = 0.0f;   // Frame time not simulated yet
+    double updateTime = 0.0;        // Time of the last frame steps (ms)
+    double drawTime = 0.0;          // Time of the last frame particles draw (ms)
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -88,31 +175,49 @@ int main(void)
     {
         // Update
         //----------------------------------------------------------------------------------
-		// Emit new particles: when emissionRate is 1, emit every frame
-        if (emissionRate < 0)
-        {
-            if (rand()%(-emissionRate) == 0) EmitParticle(&circularBuffer, emitterPosition, currentType);
-        }
-        else
+        // Run the simulation steps of the frame time, the rest is kept for the next frame
+        stepAccumulator += GetFrameTime();
+        if (stepAccumulator > MAX_STEPS_PER_FRAME*PARTICLE_TIME_STEP) stepAccumulator = MAX_STEPS_PER_FRAME*PARTICLE_TIME_STEP;
+
+        double updateStartTime = GetTime();
+        while (stepAccumulator >= PARTICLE_TIME_STEP)
         {
-            for (int i = 0; i <= emissionRate; ++i) EmitParticle(&circularBuffer, emitterPosition, currentType);
-		}
+            stepAccumulator -= PARTICLE_TIME_STEP;
 
-		// Update the parameters of each particle
-        UpdateParticles(&circularBuffer, screenWidth, screenHeight);
+            // Emit new particles: when emissionRate is 1, emit every step
+            if (emissionRate < 0)
+            {
+                if (rand()%(-emissionRate) == 0) EmitParticle(&pools[currentType], emitterPosition);
+            }
+            else
+            {
+                for (int i = 0; i <= emissionRate; ++i) EmitParticle(&pools[currentType], emitterPosition);
+            }
 
-        // Remove dead particles from the circular buffer
-        UpdateCircularBuffer(&circularBuffer);
+            // Update the parameters of each particle, dead particles are removed
+            for (int type = 0; type < 3; type++) UpdateParticles(&pools[type], screenWidth, screenHeight);
+        }
+        updateTime = (GetTime() - updateStartTime)*1000.0;
 
-        // Change Particle Emission Rate (UP/DOWN arrows)
-        if (IsKeyPressed(KEY_UP)) emissionRate++;
-        if (IsKeyPressed(KEY_DOWN)) emissionRate--;
+        // Change Particle Emission Rate (UP/DOWN arrows), x10 holding SHIFT
+        bool shiftDown = IsKeyDown(KEY_LEFT_SHIFT) || IsKeyDown(KEY_RIGHT_SHIFT);
+        if (IsKeyPressed(KEY_UP))
+        {
+            if (shiftDown && (emissionRate >= 0)) emissionRate = (emissionRate + 1)*10 - 1;
+            else emissionRate++;
+            if (emissionRate >= MAX_EMISSION_RATE) emissionRate = MAX_EMISSION_RATE - 1;
+        }
+        if (IsKeyPressed(KEY_DOWN))
+        {
+            if (shiftDown && (emissionRate > 0)) emissionRate = ((emissionRate + 1)/10 > 1)? (emissionRate + 1)/10 - 1 : 0;
+            else emissionRate--;
+        }
 
         // Change Particle Type (LEFT/RIGHT arrows)
         if (IsKeyPressed(KEY_RIGHT)) (currentType == FIRE)? (currentType = WATER) : currentType++;
         if (IsKeyPressed(KEY_LEFT)) (currentType == WATER)? (currentType = FIRE) : currentType--;
 
-		if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) emitterPosition = GetMousePosition();
+        if (IsMouseButtonDown(MOUSE_LEFT_BUTTON)) emitterPosition = GetMousePosition();
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -121,19 +226,32 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-		    // Call the function with a loop to draw all particles
-            DrawParticles(&circularBuffer);
+            // Call the function with a loop to draw all particles
+            // NOTE: Batched particles are sent to the GPU before measuring
+            double drawStartTime = GetTime();
+            for (int type = 0; type < 3; type++) DrawParticles(&pools[type], particleTexture.texture);
+            rlDrawRenderBatchActive();
+            drawTime = (GetTime() - drawStartTime)*1000.0;
 
             // Draw UI and Instructions
             DrawRectangle(5, 5, 315, 75, Fade(SKYBLUE, 0.5f));
             DrawRectangleLines(5, 5, 315, 75, BLUE);
 
             DrawText("CONTROLS:", 15, 15, 10, BLACK);
-            DrawText("UP/DOWN: Change Particle Emission Rate", 15, 35, 10, BLACK);
+            DrawText("UP/DOWN: Change Particle Emission Rate (SHIFT: x10)", 15, 35, 10, BLACK);
             DrawText("LEFT/RIGHT: Change Particle Type (Water, Smoke, Fire)", 15, 55, 10, BLACK);
 
-            if (emissionRate < 0) DrawText(TextFormat("Particles every %d frames | Type: %s", -emissionRate, particleTypeNames[currentType]), 15, 95, 10, DARKGRAY);
-		    else DrawText(TextFormat("%d Particles per frame | Type: %s", emissionRate + 1, particleTypeNames[currentType]), 15, 95, 10, DARKGRAY);
+            if (emissionRate < 0) DrawText(TextFormat("Particles every %d steps | Type: %s", -emissionRate, particleTypeNames[currentType]), 15, 95, 10, DARKGRAY);
+            else DrawText(TextFormat("%d Particles per step | Type: %s", emissionRate + 1, particleTypeNames[currentType]), 15, 95, 10, DARKGRAY);
+
+            // Draw update and draw cost, both grow with the particles
+            DrawRectangle(screenWidth - 225, 35, 220, 95, Fade(SKYBLUE, 0.5f));
+            DrawRectangleLines(screenWidth - 225, 35, 220, 95, BLUE);
+            DrawText(TextFormat("Particles: %d", pools[WATER].count + pools[SMOKE].count + pools[FIRE].count), screenWidth - 215, 45, 10, BLACK);
+            DrawText(TextFormat("Water: %d | Smoke: %d | Fire: %d", pools[WATER].count, pools[SMOKE].count, pools[FIRE].count), screenWidth - 215, 60, 10, DARKGRAY);
+            DrawText(TextFormat("Update (SIMD %s): %.2f ms", PARTICLE_SIMD_NAME, updateTime), screenWidth - 215, 80, 10, DARKGREEN);
+            DrawText(TextFormat("Draw: %.2f ms", drawTime), screenWidth - 215, 95, 10, MAROON);
+            DrawText(TextFormat("Step: %.1f ms fixed", PARTICLE_TIME_STEP*1000.0f), screenWidth - 215, 110, 10, DARKGRAY);
 
             DrawFPS(screenWidth - 80, 10);
 
@@ -143,7 +261,9 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
-    RL_FREE(particles);     // Free particles array data
+    UnloadRenderTexture(particleTexture);   // Unload particle texture
+
+    for (int type = 0; type < 3; type++) UnloadParticlePool(&pools[type]);  // Free particles arrays data
 
     CloseWindow();          // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -154,131 +274,196 @@ int main(void)
 //----------------------------------------------------------------------------------
 // Module Functions Definition
 //----------------------------------------------------------------------------------
-static void EmitParticle(CircularBuffer *circularBuffer, Vector2 emitterPosition, ParticleType type)
+// Create an empty particles pool, arrays are allocated on the first emission
+static ParticlePool LoadParticlePool(ParticleType type)
 {
-    Particle *newParticle = AddToCircularBuffer(circularBuffer);
+    ParticlePool pool = { 0 };
+    pool.type = type;
 
-    // If buffer is full, newParticle is NULL
-    if (newParticle != NULL)
-    {
-        // Fill particle properties
-        newParticle->position = emitterPosition;
-        newParticle->alive = true;
-        newParticle->lifeTime = 0.0f;
-        newParticle->type = type;
-        float speed = (float)(rand()%10)/5.0f;
-        switch (type)
-        {
-            case WATER:
-            {
-                newParticle->radius = 5.0f;
-                newParticle->color = BLUE;
-            } break;
-            case SMOKE:
-            {
-                newParticle->radius = 7.0f;
-                newParticle->color = GRAY;
-            } break;
-            case FIRE:
-            {
-                newParticle->radius = 10.0f;
-                newParticle->color = YELLOW;
-                speed /= 10.0f;
-            } break;
-            default: break;
-        }
+    return pool;
+}
 
-        float direction = (float)(rand()%360);
-        newParticle->velocity = (Vector2){ speed*cosf(direction*DEG2RAD), speed*sinf(direction*DEG2RAD) };
-    }
+// Free a particles pool
+static void UnloadParticlePool(ParticlePool *pool)
+{
+    RL_FREE(pool->positionX);
+    RL_FREE(pool->positionY);
+    RL_FREE(pool->velocityX);
+    RL_FREE(pool->velocityY);
+    RL_FREE(pool->wobbleCos);
+    RL_FREE(pool->wobbleSin);
+    RL_FREE(pool->radius);
+    RL_FREE(pool->lifeTime);
+    RL_FREE(pool->dead);
+
+    *pool = (ParticlePool){ 0 };
 }
 
-static Particle *AddToCircularBuffer(CircularBuffer *circularBuffer)
+// Grow the pool arrays to capacity particles
+// NOTE: Arrays have room for a last partial SIMD batch
+static bool ResizeParticlePool(ParticlePool *pool, int capacity)
 {
-    Particle *particle = NULL;
+    int size = capacity + PARTICLE_SIMD_WIDTH;
+    float **arrays[8] = { &pool->positionX, &pool->positionY, &pool->velocityX, &pool->velocityY,
+                          &pool->wobbleCos, &pool->wobbleSin, &pool->radius, &pool->lifeTime };
 
-    // Check if buffer full
-    if (((circularBuffer->head + 1)%MAX_PARTICLES) != circularBuffer->tail)
+    for (int i = 0; i < 8; i++)
     {
-		// Add new particle to the head position and advance head
-        particle = &circularBuffer->buffer[circularBuffer->head];
-        circularBuffer->head = (circularBuffer->head + 1)%MAX_PARTICLES;
+        float *array = (float *)RL_REALLOC(*arrays[i], size*sizeof(float));
+        if (array == NULL) return false;
+        *arrays[i] = array;
     }
 
-	return particle;
+    int *dead = (int *)RL_REALLOC(pool->dead, size*sizeof(int));
+    if (dead == NULL) return false;
+    pool->dead = dead;
+
+    pool->capacity = capacity;
+
+    return true;
 }
 
-static void UpdateParticles(CircularBuffer *circularBuffer, int screenWidth, int screenHeight)
+// Add a particle at the end of the live particles, ignored if the pool is full
+static void EmitParticle(ParticlePool *pool, Vector2 emitterPosition)
 {
-    for (int i = circularBuffer->tail; i != circularBuffer->head; i = (i + 1)%MAX_PARTICLES)
+    if (pool->count >= pool->capacity)
     {
-        // Update particle life and positions
-		circularBuffer->buffer[i].lifeTime += 1.0f/60.0f; // 60 FPS -> 1/60 seconds per frame
+        int capacity = (pool->capacity == 0)? 1024 : pool->capacity*2;
+        if (capacity > MAX_PARTICLES) capacity = MAX_PARTICLES;
+        if ((capacity == pool->capacity) || !ResizeParticlePool(pool, capacity)) return;
+    }
 
-        switch (circularBuffer->buffer[i].type)
-        {
-            case WATER:
-            {
-                circularBuffer->buffer[i].position.x += circularBuffer->buffer[i].velocity.x;
-                circularBuffer->buffer[i].velocity.y += 0.2f;   // Gravity
-                circularBuffer->buffer[i].position.y += circularBuffer->buffer[i].velocity.y;
-            } break;
-            case SMOKE:
-            {
-                circularBuffer->buffer[i].position.x += circularBuffer->buffer[i].velocity.x;
-				circularBuffer->buffer[i].velocity.y -= 0.05f;  // Upwards
-                circularBuffer->buffer[i].position.y += circularBuffer->buffer[i].velocity.y;
-                circularBuffer->buffer[i].radius += 0.5f;       // Increment radius: smoke expands
-				circularBuffer->buffer[i].color.a -= 4;         // Decrement alpha: smoke fades
-				
-                // If alpha transparent, particle dies
-                if (circularBuffer->buffer[i].color.a < 4) circularBuffer->buffer[i].alive = false;
-            } break;
-            case FIRE:
-            {
-				// Add a little horizontal oscillation to fire particles
-                circularBuffer->buffer[i].position.x += circularBuffer->buffer[i].velocity.x + cosf(circularBuffer->buffer[i].lifeTime*215.0f);
-                circularBuffer->buffer[i].velocity.y -= 0.05f;  // Upwards
-                circularBuffer->buffer[i].position.y += circularBuffer->buffer[i].velocity.y;
-				circularBuffer->buffer[i].radius -= 0.15f;      // Decrement radius: fire shrinks
-				circularBuffer->buffer[i].color.g -= 3;         // Decrement green: fire turns reddish starting from yellow
-				
-                // If radius too small, particle dies
-                if (circularBuffer->buffer[i].radius <= 0.02f) circularBuffer->buffer[i].alive = false;
-            } break;
-            default: break;
-        }
+    const ParticleEmitter *emitter = &particleEmitters[pool->type];
+    float speed = emitter->speed*(float)(rand()%10)/10.0f;
+    float direction = (float)(rand()%360);
+
+    // Fill particle properties
+    int i = pool->count;
+    pool->positionX[i] = emitterPosition.x;
+    pool->positionY[i] = emitterPosition.y;
+    pool->velocityX[i] = speed*cosf(direction*DEG2RAD);
+    pool->velocityY[i] = speed*sinf(direction*DEG2RAD);
+    pool->wobbleCos[i] = 1.0f;
+    pool->wobbleSin[i] = 0.0f;
+    pool->radius[i] = emitter->radius;
+    pool->lifeTime[i] = 0.0f;
+    pool->count++;
+}
+
+// Move the particles one time step and remove the dead ones: out of screen, too small or too old
+// NOTE: Particles are integrated PARTICLE_SIMD_WIDTH at a time, the particles found dead are
+// swap-removed afterwards, last dead particle first, so the particle moved into a dead one is always alive
+static void UpdateParticles(ParticlePool *pool, int screenWidth, int screenHeight)
+{
+    const ParticleEmitter *emitter = &particleEmitters[pool->type];
+    const float wobbleStepCos = cosf(emitter->wobbleSpeed);
+    const float wobbleStepSin = sinf(emitter->wobbleSpeed);
+    int count = pool->count;
+    int deadCount = 0;
+    int i = 0;
+
+#if (PARTICLE_SIMD_WIDTH > 1)
+    const SIMD_FLOAT stepCos = SIMD_SET(wobbleStepCos), stepSin = SIMD_SET(wobbleStepSin);
+    const SIMD_FLOAT wobble = SIMD_SET(emitter->wobble), gravity = SIMD_SET(emitter->gravity);
+    const SIMD_FLOAT radiusSpeed = SIMD_SET(emitter->radiusSpeed), minRadius = SIMD_SET(emitter->minRadius);
+    const SIMD_FLOAT timeStep = SIMD_SET(PARTICLE_TIME_STEP), lifeTime = SIMD_SET(emitter->lifeTime);
+    const SIMD_FLOAT zero = SIMD_SET(0.0f), width = SIMD_SET((float)screenWidth), height = SIMD_SET((float)screenHeight);
+
+    for (; i + PARTICLE_SIMD_WIDTH <= count; i += PARTICLE_SIMD_WIDTH)
+    {
+        // Rotate the oscillation phase
+        SIMD_FLOAT wobbleCos = SIMD_LOAD(pool->wobbleCos + i);
+        SIMD_FLOAT wobbleSin = SIMD_LOAD(pool->wobbleSin + i);
+        SIMD_FLOAT nextCos = SIMD_SUB(SIMD_MUL(wobbleCos, stepCos), SIMD_MUL(wobbleSin, stepSin));
+        wobbleSin = SIMD_ADD(SIMD_MUL(wobbleSin, stepCos), SIMD_MUL(wobbleCos, stepSin));
+        wobbleCos = nextCos;
+
+        // Move, apply gravity, grow and age
+        SIMD_FLOAT x = SIMD_ADD(SIMD_LOAD(pool->positionX + i), SIMD_ADD(SIMD_LOAD(pool->velocityX + i), SIMD_MUL(wobble, wobbleCos)));
+        SIMD_FLOAT velocityY = SIMD_ADD(SIMD_LOAD(pool->velocityY + i), gravity);
+        SIMD_FLOAT y = SIMD_ADD(SIMD_LOAD(pool->positionY + i), velocityY);
+        SIMD_FLOAT radius = SIMD_ADD(SIMD_LOAD(pool->radius + i), radiusSpeed);
+        SIMD_FLOAT life = SIMD_ADD(SIMD_LOAD(pool->lifeTime + i), timeStep);
+
+        SIMD_STORE(pool->wobbleCos + i, wobbleCos);
+        SIMD_STORE(pool->wobbleSin + i, wobbleSin);
+        SIMD_STORE(pool->positionX + i, x);
+        SIMD_STORE(pool->velocityY + i, velocityY);
+        SIMD_STORE(pool->positionY + i, y);
+        SIMD_STORE(pool->radius + i, radius);
+        SIMD_STORE(pool->lifeTime + i, life);
+
+        // Dead particles, out of screen, too small or too old
+        SIMD_FLOAT dead = SIMD_OR(SIMD_LE(radius, minRadius), SIMD_GE(life, lifeTime));
+        dead = SIMD_OR(dead, SIMD_OR(SIMD_LT(SIMD_ADD(x, radius), zero), SIMD_GT(SIMD_SUB(x, radius), width)));
+        dead = SIMD_OR(dead, SIMD_OR(SIMD_LT(SIMD_ADD(y, radius), zero), SIMD_GT(SIMD_SUB(y, radius), height)));
+
+        int mask = SIMD_MASK(dead);
+        for (int lane = 0; mask != 0; lane++, mask >>= 1) if (mask & 1) pool->dead[deadCount++] = i + lane;
+    }
+#endif
+
+    // Particles left out of the SIMD batches, same operations one particle at a time
+    for (; i < count; i++)
+    {
+        float wobbleCos = pool->wobbleCos[i]*wobbleStepCos - pool->wobbleSin[i]*wobbleStepSin;
+        pool->wobbleSin[i] = pool->wobbleSin[i]*wobbleStepCos + pool->wobbleCos[i]*wobbleStepSin;
+        pool->wobbleCos[i] = wobbleCos;
+
+        float x = pool->positionX[i] + (pool->velocityX[i] + emitter->wobble*wobbleCos);
+        float velocityY = pool->velocityY[i] + emitter->gravity;
+        float y = pool->positionY[i] + velocityY;
+        float radius = pool->radius[i] + emitter->radiusSpeed;
+        float life = pool->lifeTime[i] + PARTICLE_TIME_STEP;
+
+        pool->positionX[i] = x;
+        pool->velocityY[i] = velocityY;
+        pool->positionY[i] = y;
+        pool->radius[i] = radius;
+        pool->lifeTime[i] = life;
+
+        if ((radius <= emitter->minRadius) || (life >= emitter->lifeTime) ||
+            ((x + radius) < 0.0f) || ((x - radius) > screenWidth) ||
+            ((y + radius) < 0.0f) || ((y - radius) > screenHeight)) pool->dead[deadCount++] = i;
+    }
 
-		// Disable particle when out of screen
-        Vector2 center = circularBuffer->buffer[i].position;
-		float radius = circularBuffer->buffer[i].radius;
+    // Remove dead particles, the last live particle takes the place of every dead one
+    for (int d = deadCount - 1; d >= 0; d--)
+    {
+        int dead = pool->dead[d];
+        int last = --pool->count;
 
-        if ((center.x < -radius) || (center.x > (screenWidth + radius)) ||
-            (center.y < -radius) || (center.y > (screenHeight + radius)))
+        if (dead != last)
         {
-            circularBuffer->buffer[i].alive = false;
+            pool->positionX[dead] = pool->positionX[last];
+            pool->positionY[dead] = pool->positionY[last];
+            pool->velocityX[dead] = pool->velocityX[last];
+            pool->velocityY[dead] = pool->velocityY[last];
+            pool->wobbleCos[dead] = pool->wobbleCos[last];
+            pool->wobbleSin[dead] = pool->wobbleSin[last];
+            pool->radius[dead] = pool->radius[last];
+            pool->lifeTime[dead] = pool->lifeTime[last];
         }
     }
 }
 
-static void UpdateCircularBuffer(CircularBuffer *circularBuffer)
+// Draw all the pool particles, particle color follows its life time
+static void DrawParticles(const ParticlePool *pool, Texture2D texture)
 {
-    // Update circular buffer: advance tail over dead particles
-    while ((circularBuffer->tail != circularBuffer->head) && !circularBuffer->buffer[circularBuffer->tail].alive)
-    {
-        circularBuffer->tail = (circularBuffer->tail + 1)%MAX_PARTICLES;
-	}
-}
+    const ParticleEmitter *emitter = &particleEmitters[pool->type];
+    Rectangle source = { 0.0f, 0.0f, (float)texture.width, (float)texture.height };
 
-static void DrawParticles(CircularBuffer *circularBuffer)
-{
-    for (int i = circularBuffer->tail; i != circularBuffer->head; i = (i + 1)%MAX_PARTICLES)
+    for (int i = 0; i < pool->count; i++)
     {
-        if (circularBuffer->buffer[i].alive)
-        {
-            DrawCircleV(circularBuffer->buffer[i].position,
-                        circularBuffer->buffer[i].radius,
-                        circularBuffer->buffer[i].color);
-        }
+        int steps = (int)(pool->lifeTime[i]/PARTICLE_TIME_STEP + 0.5f);
+        Color color = emitter->color;
+        color.r = (unsigned char)((color.r > emitter->colorFade.r*steps)? color.r - emitter->colorFade.r*steps : 0);
+        color.g = (unsigned char)((color.g > emitter->colorFade.g*steps)? color.g - emitter->colorFade.g*steps : 0);
+        color.b = (unsigned char)((color.b > emitter->colorFade.b*steps)? color.b - emitter->colorFade.b*steps : 0);
+        color.a = (unsigned char)((color.a > emitter->colorFade.a*steps)? color.a - emitter->colorFade.a*steps : 0);
+
+        float radius = pool->radius[i];
+        DrawTexturePro(texture, source, (Rectangle){ pool->positionX[i] - radius, pool->positionY[i] - radius, radius*2.0f, radius*2.0f },
+            (Vector2){ 0.0f, 0.0f }, 0.0f, color);
     }
 }
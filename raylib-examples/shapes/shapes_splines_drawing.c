@@ -19,8 +19,17 @@
 #include "raygui.h"     // Required for UI controls
 
 #include <stdlib.h>     // Required for: NULL
+#include <math.h>       // Required for: sqrtf(), sinf(), cosf(), fmodf(), fabsf()
 
-#define MAX_SPLINE_POINTS      32
+#define MAX_SPLINE_POINTS      4096
+#define STRESS_SPLINE_POINTS   4000     // Points generated by the stress test
+
+#define SPLINE_FLATNESS        0.25f    // Max distance between the curve and its polyline (pixels)
+#define SPLINE_MAX_DEPTH       12       // Max subdivisions of a curve segment, up to 4096 lines per segment
+#define SPLINE_HELPERS_MAX     64       // Points count up to which the point coordinates are drawn
+
+#define MARKER_SPEED           200.0f   // Constant speed of the marker moving along the spline (pixels/second)
+#define SAMPLES_SPACING        20.0f    // Distance between the evenly spaced samples along the spline (pixels)
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -40,6 +49,40 @@ typedef enum {
     SPLINE_BEZIER           // Cubic Bezier
 } SplineType;
 
+// Spline segment tessellation, kept until a point of the segment changes
+typedef struct {
+    Vector2 *points;        // Polyline of the segment, as many points as its curvature requires
+    float *lengths;         // Arc length from the segment start to every polyline point
+    Vector2 *strip;         // Triangle strip of the polyline, two vertices per point
+    int count;
+    int capacity;
+    Rectangle bounds;       // Strip bounds, segments out of view are not drawn
+    bool dirty;             // Segment must be tessellated again
+} SplineSegment;
+
+// Spline tessellation cache, one entry per curve segment
+// NOTE: All spline types are converted to cubic Bezier segments and subdivided until flat,
+// edits only invalidate the segments that use the edited point
+typedef struct {
+    SplineSegment *segments;
+    float *segmentStart;    // Arc length at the start of every segment, the last entry is the spline length
+    int segmentCount;
+    int capacity;           // Max segments
+    int type;               // Spline type of the tessellation
+    float thickness;        // Spline thickness of the triangle strips
+    int tessellated;        // Segments tessellated on the last update
+} SplineCache;
+
+//------------------------------------------------------------------------------------
+// Module Functions Declaration
+//------------------------------------------------------------------------------------
+static SplineCache LoadSplineCache(int maxSegments);
+static void UnloadSplineCache(SplineCache *cache);
+static void InvalidateSplinePoint(SplineCache *cache, int type, int point);
+static void UpdateSplineCache(SplineCache *cache, const Vector2 *points, const ControlPoint *control, int pointCount, int type, float thickness);
+static void DrawSplineCache(const SplineCache *cache, Rectangle view, Color color);
+static Vector2 GetSplineCachePoint(const SplineCache *cache, float distance);
+
 //------------------------------------------------------------------------------------
 // Program main entry point
 //------------------------------------------------------------------------------------
@@ -53,17 +96,12 @@ int main(void)
     SetConfigFlags(FLAG_MSAA_4X_HINT);
     InitWindow(screenWidth, screenHeight, "raylib [shapes] example - splines drawing");
 
-    Vector2 points[MAX_SPLINE_POINTS] = {
-        {  50.0f, 400.0f },
-        { 160.0f, 220.0f },
-        { 340.0f, 380.0f },
-        { 520.0f, 60.0f },
-        { 710.0f, 260.0f },
-    };
-
-    // Array required for spline bezier-cubic,
-    // including control points interleaved with start-end segment points
-    Vector2 pointsInterleaved[3*(MAX_SPLINE_POINTS - 1) + 1] = { 0 };
+    Vector2 *points = (Vector2 *)RL_CALLOC(MAX_SPLINE_POINTS, sizeof(Vector2));
+    points[0] = (Vector2){  50.0f, 400.0f };
+    points[1] = (Vector2){ 160.0f, 220.0f };
+    points[2] = (Vector2){ 340.0f, 380.0f };
+    points[3] = (Vector2){ 520.0f, 60.0f };
+    points[4] = (Vector2){ 710.0f, 260.0f };
 
     int pointCount = 5;
     int selectedPoint = -1;
@@ -72,7 +110,7 @@ int main(void)
     Vector2 *focusedControlPoint = NULL;
 
     // Cubic Bezier control points initialization
-    ControlPoint control[MAX_SPLINE_POINTS-1] = { 0 };
+    ControlPoint *control = (ControlPoint *)RL_CALLOC(MAX_SPLINE_POINTS - 1, sizeof(ControlPoint));
     for (int i = 0; i < pointCount - 1; i++)
     {
         control[i].start = (Vector2){ points[i].x + 50, points[i].y };
@@ -84,6 +122,12 @@ int main(void)
     int splineTypeActive = SPLINE_LINEAR; // 0-Linear, 1-BSpline, 2-CatmullRom, 3-Bezier
     bool splineTypeEditMode = false;
     bool splineHelpersActive = true;
+    bool samplesActive = false;
+
+    // Spline tessellation, only updated for the segments next to the edited points
+    SplineCache spline = LoadSplineCache(MAX_SPLINE_POINTS - 1);
+    double tessellationTime = 0.0;  // Time of the last spline cache update (ms)
+    float markerDistance = 0.0f;    // Marker position along the spline, as arc length
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -103,6 +147,27 @@ int main(void)
             pointCount++;
         }
 
+        // Stress test, a long spline of many points along a Lissajous curve
+        if (IsKeyPressed(KEY_G))
+        {
+            pointCount = STRESS_SPLINE_POINTS;
+            for (int i = 0; i < pointCount; i++)
+            {
+                float t = 2.0f*PI*i/pointCount;
+                points[i] = (Vector2){ 460.0f + 320.0f*sinf(5.0f*t + 0.5f), 225.0f + 200.0f*sinf(4.0f*t) };
+            }
+
+            for (int i = 0; i < pointCount - 1; i++)
+            {
+                control[i].start = (Vector2){ points[i].x + (points[i + 1].x - points[i].x)/3.0f, points[i].y + (points[i + 1].y - points[i].y)/3.0f };
+                control[i].end = (Vector2){ points[i + 1].x - (points[i + 1].x - points[i].x)/3.0f, points[i + 1].y - (points[i + 1].y - points[i].y)/3.0f };
+            }
+
+            for (int i = 0; i < pointCount; i++) InvalidateSplinePoint(&spline, splineTypeActive, i);
+            selectedPoint = -1;
+            selectedControlPoint = NULL;
+        }
+
         // Spline point focus and selection logic
         if ((selectedPoint == -1) && ((splineTypeActive != SPLINE_BEZIER) || (selectedControlPoint == NULL)))
         {
@@ -122,6 +187,7 @@ int main(void)
         if (selectedPoint >= 0)
         {
             points[selectedPoint] = GetMousePosition();
+            InvalidateSplinePoint(&spline, splineTypeActive, selectedPoint);
             if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) selectedPoint = -1;
         }
 
@@ -152,6 +218,11 @@ int main(void)
             if (selectedControlPoint != NULL)
             {
                 *selectedControlPoint = GetMousePosition();
+
+                // Control points only belong to their own segment, invalidated as the segment start point
+                int segment = (int)(((char *)selectedControlPoint - (char *)control)/sizeof(ControlPoint));
+                spline.segments[segment].dirty = true;
+
                 if (IsMouseButtonReleased(MOUSE_LEFT_BUTTON)) selectedControlPoint = NULL;
             }
         }
@@ -164,6 +235,18 @@ int main(void)
 
         // Clear selection when changing to a spline without control points
         if (IsKeyPressed(KEY_ONE) || IsKeyPressed(KEY_TWO) || IsKeyPressed(KEY_THREE)) selectedControlPoint = NULL;
+
+        if (IsKeyPressed(KEY_S)) samplesActive = !samplesActive;
+
+        // Tessellate the invalidated segments only
+        double tessellationStartTime = GetTime();
+        UpdateSplineCache(&spline, points, control, pointCount, splineTypeActive, splineThickness);
+        if (spline.tessellated > 0) tessellationTime = (GetTime() - tessellationStartTime)*1000.0;
+
+        // Move the marker at constant speed, the arc length tables map distance to spline points
+        float splineLength = spline.segmentStart[spline.segmentCount];
+        markerDistance += MARKER_SPEED*GetFrameTime();
+        if (splineLength > 0.0f) markerDistance = fmodf(markerDistance, splineLength);
         //----------------------------------------------------------------------------------
 
         // Draw
@@ -172,61 +255,11 @@ int main(void)
 
             ClearBackground(RAYWHITE);
 
-            if (splineTypeActive == SPLINE_LINEAR)
-            {
-                // Draw spline: linear
-                DrawSplineLinear(points, pointCount, splineThickness, RED);
-            }
-            else if (splineTypeActive == SPLINE_BASIS)
-            {
-                // Draw spline: basis
-                DrawSplineBasis(points, pointCount, splineThickness, RED);  // Provide connected points array
-
-                /*
-                for (int i = 0; i < (pointCount - 3); i++)
-                {
-                    // Drawing individual segments, not considering thickness connection compensation
-                    DrawSplineSegmentBasis(points[i], points[i + 1], points[i + 2], points[i + 3], splineThickness, MAROON);
-                }
-                */
-            }
-            else if (splineTypeActive == SPLINE_CATMULLROM)
-            {
-                // Draw spline: catmull-rom
-                DrawSplineCatmullRom(points, pointCount, splineThickness, RED); // Provide connected points array
+            // Draw spline, cached triangle strips of the segments in view
+            DrawSplineCache(&spline, (Rectangle){ 0, 0, (float)screenWidth, (float)screenHeight }, RED);
 
-                /*
-                for (int i = 0; i < (pointCount - 3); i++)
-                {
-                    // Drawing individual segments, not considering thickness connection compensation
-                    DrawSplineSegmentCatmullRom(points[i], points[i + 1], points[i + 2], points[i + 3], splineThickness, MAROON);
-                }
-                */
-            }
-            else if (splineTypeActive == SPLINE_BEZIER)
+            if (splineTypeActive == SPLINE_BEZIER)
             {
-                // NOTE: Cubic-bezier spline requires the 2 control points of each segnment to be
-                // provided interleaved with the start and end point of every segment
-                for (int i = 0; i < (pointCount - 1); i++)
-                {
-                    pointsInterleaved[3*i] = points[i];
-                    pointsInterleaved[3*i + 1] = control[i].start;
-                    pointsInterleaved[3*i + 2] = control[i].end;
-                }
-
-                pointsInterleaved[3*(pointCount - 1)] = points[pointCount - 1];
-
-                // Draw spline: cubic-bezier (with control points)
-                DrawSplineBezierCubic(pointsInterleaved, 3*(pointCount - 1) + 1, splineThickness, RED);
-
-                /*
-                for (int i = 0; i < 3*(pointCount - 1); i += 3)
-                {
-                    // Drawing individual segments, not considering thickness connection compensation
-                    DrawSplineSegmentBezierCubic(pointsInterleaved[i], pointsInterleaved[i + 1], pointsInterleaved[i + 2], pointsInterleaved[i + 3], splineThickness, MAROON);
-                }
-                */
-
                 // Draw spline control points
                 for (int i = 0; i < pointCount - 1; i++)
                 {
@@ -255,10 +288,18 @@ int main(void)
                         (splineTypeActive != SPLINE_BEZIER) &&
                         (i < pointCount - 1)) DrawLineV(points[i], points[i + 1], GRAY);
 
-                    DrawText(TextFormat("[%.0f, %.0f]", points[i].x, points[i].y), (int)points[i].x, (int)points[i].y + 10, 10, BLACK);
+                    if (pointCount <= SPLINE_HELPERS_MAX) DrawText(TextFormat("[%.0f, %.0f]", points[i].x, points[i].y), (int)points[i].x, (int)points[i].y + 10, 10, BLACK);
                 }
             }
 
+            // Draw samples evenly spaced along the spline and the constant speed marker
+            if (samplesActive)
+            {
+                for (float d = 0.0f; d < splineLength; d += SAMPLES_SPACING) DrawCircleV(GetSplineCachePoint(&spline, d), 3.0f, DARKGREEN);
+            }
+
+            if (splineLength > 0.0f) DrawCircleV(GetSplineCachePoint(&spline, markerDistance), splineThickness*0.5f + 4.0f, DARKBLUE);
+
             // Check all possible UI states that require controls lock
             if (splineTypeEditMode || (selectedPoint != -1) || (selectedControlPoint != NULL)) GuiLock();
 
@@ -275,14 +316,296 @@ int main(void)
 
             GuiUnlock();
 
+            // Draw tessellation stats
+            int vertexCount = 0;
+            for (int i = 0; i < spline.segmentCount; i++) vertexCount += spline.segments[i].count;
+
+            DrawText(TextFormat("Points: %i, segments: %i, polyline points: %i", pointCount, spline.segmentCount, vertexCount), 12, screenHeight - 50, 10, DARKGRAY);
+            DrawText(TextFormat("Last tessellation: %i segments, %.3f ms, length: %.0f", spline.tessellated, tessellationTime, splineLength), 12, screenHeight - 35, 10, DARKGRAY);
+            DrawText("(G) Generate many points, (S) Show evenly spaced samples", 12, screenHeight - 20, 10, DARKGRAY);
+
         EndDrawing();
         //----------------------------------------------------------------------------------
     }
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
+    UnloadSplineCache(&spline);
+    RL_FREE(points);
+    RL_FREE(control);
+
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
 
     return 0;
 }
+
+//------------------------------------------------------------------------------------
+// Module Functions Definition
+//------------------------------------------------------------------------------------
+// Load spline cache, segments polylines are allocated on first tessellation
+static SplineCache LoadSplineCache(int maxSegments)
+{
+    SplineCache cache = { 0 };
+
+    cache.segments = (SplineSegment *)RL_CALLOC(maxSegments, sizeof(SplineSegment));
+    cache.segmentStart = (float *)RL_CALLOC(maxSegments + 1, sizeof(float));
+    cache.capacity = maxSegments;
+    cache.type = -1;
+
+    return cache;
+}
+
+// Unload spline cache
+static void UnloadSplineCache(SplineCache *cache)
+{
+    for (int i = 0; i < cache->capacity; i++)
+    {
+        RL_FREE(cache->segments[i].points);
+        RL_FREE(cache->segments[i].lengths);
+        RL_FREE(cache->segments[i].strip);
+    }
+
+    RL_FREE(cache->segments);
+    RL_FREE(cache->segmentStart);
+}
+
+// Invalidate the segments using a spline point
+// NOTE: Linear and Bezier segments use their start and end points, B-Spline and
+// Catmull-Rom segments use four consecutive points, from the segment index on
+static void InvalidateSplinePoint(SplineCache *cache, int type, int point)
+{
+    int first = ((type == SPLINE_BASIS) || (type == SPLINE_CATMULLROM))? point - 3 : point - 1;
+
+    for (int i = (first < 0)? 0 : first; (i <= point) && (i < cache->segmentCount); i++) cache->segments[i].dirty = true;
+}
+
+// Add a point to a segment polyline, growing its arrays if required
+static void AddSegmentPoint(SplineSegment *segment, Vector2 point)
+{
+    if (segment->count == segment->capacity)
+    {
+        segment->capacity = (segment->capacity == 0)? 16 : segment->capacity*2;
+        segment->points = (Vector2 *)RL_REALLOC(segment->points, segment->capacity*sizeof(Vector2));
+        segment->lengths = (float *)RL_REALLOC(segment->lengths, segment->capacity*sizeof(float));
+        segment->strip = (Vector2 *)RL_REALLOC(segment->strip, 2*segment->capacity*sizeof(Vector2));
+    }
+
+    float length = 0.0f;
+    if (segment->count > 0)
+    {
+        Vector2 previous = segment->points[segment->count - 1];
+        float dx = point.x - previous.x;
+        float dy = point.y - previous.y;
+        length = segment->lengths[segment->count - 1] + sqrtf(dx*dx + dy*dy);
+    }
+
+    segment->points[segment->count] = point;
+    segment->lengths[segment->count] = length;
+    segment->count++;
+}
+
+// Subdivide a cubic Bezier curve until it is flat, adding the end point of every flat piece
+// NOTE: A piece is flat when both control points are closer than SPLINE_FLATNESS to its chord
+static void TessellateCubic(SplineSegment *segment, Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, int depth)
+{
+    float chordX = p3.x - p0.x;
+    float chordY = p3.y - p0.y;
+    float chord2 = chordX*chordX + chordY*chordY;
+
+    // Control points distance to the chord times the chord length, or to p0 if the chord is a point
+    float d1 = (p1.x - p0.x)*chordY - (p1.y - p0.y)*chordX;
+    float d2 = (p2.x - p0.x)*chordY - (p2.y - p0.y)*chordX;
+    bool flat = false;
+
+    if (chord2 > 1e-6f) flat = ((d1*d1 <= SPLINE_FLATNESS*SPLINE_FLATNESS*chord2) && (d2*d2 <= SPLINE_FLATNESS*SPLINE_FLATNESS*chord2));
+    else flat = ((fabsf(p1.x - p0.x) + fabsf(p1.y - p0.y) + fabsf(p2.x - p0.x) + fabsf(p2.y - p0.y)) <= SPLINE_FLATNESS);
+
+    if (flat || (depth >= SPLINE_MAX_DEPTH))
+    {
+        AddSegmentPoint(segment, p3);
+        return;
+    }
+
+    // Split at t = 0.5 (de Casteljau)
+    Vector2 p01 = { (p0.x + p1.x)*0.5f, (p0.y + p1.y)*0.5f };
+    Vector2 p12 = { (p1.x + p2.x)*0.5f, (p1.y + p2.y)*0.5f };
+    Vector2 p23 = { (p2.x + p3.x)*0.5f, (p2.y + p3.y)*0.5f };
+    Vector2 p012 = { (p01.x + p12.x)*0.5f, (p01.y + p12.y)*0.5f };
+    Vector2 p123 = { (p12.x + p23.x)*0.5f, (p12.y + p23.y)*0.5f };
+    Vector2 middle = { (p012.x + p123.x)*0.5f, (p012.y + p123.y)*0.5f };
+
+    TessellateCubic(segment, p0, p01, p012, middle, depth + 1);
+    TessellateCubic(segment, middle, p123, p23, p3, depth + 1);
+}
+
+// Tessellate a spline segment and build its triangle strip
+// NOTE: Segments of every spline type are converted to their cubic Bezier control points
+static void TessellateSplineSegment(SplineSegment *segment, const Vector2 *points, const ControlPoint *control, int index, int type, float thickness)
+{
+    Vector2 b[4] = { 0 };
+
+    if (type == SPLINE_BASIS)
+    {
+        const Vector2 *p = points + index;
+        b[0] = (Vector2){ (p[0].x + 4.0f*p[1].x + p[2].x)/6.0f, (p[0].y + 4.0f*p[1].y + p[2].y)/6.0f };
+        b[1] = (Vector2){ (2.0f*p[1].x + p[2].x)/3.0f, (2.0f*p[1].y + p[2].y)/3.0f };
+        b[2] = (Vector2){ (p[1].x + 2.0f*p[2].x)/3.0f, (p[1].y + 2.0f*p[2].y)/3.0f };
+        b[3] = (Vector2){ (p[1].x + 4.0f*p[2].x + p[3].x)/6.0f, (p[1].y + 4.0f*p[2].y + p[3].y)/6.0f };
+    }
+    else if (type == SPLINE_CATMULLROM)
+    {
+        const Vector2 *p = points + index;
+        b[0] = p[1];
+        b[1] = (Vector2){ p[1].x + (p[2].x - p[0].x)/6.0f, p[1].y + (p[2].y - p[0].y)/6.0f };
+        b[2] = (Vector2){ p[2].x - (p[3].x - p[1].x)/6.0f, p[2].y - (p[3].y - p[1].y)/6.0f };
+        b[3] = p[2];
+    }
+    else if (type == SPLINE_BEZIER)
+    {
+        b[0] = points[index];
+        b[1] = control[index].start;
+        b[2] = control[index].end;
+        b[3] = points[index + 1];
+    }
+    else
+    {
+        // Linear segments are flat, the tessellation is the segment itself
+        b[0] = points[index];
+        b[3] = points[index + 1];
+        b[1] = b[0];
+        b[2] = b[3];
+    }
+
+    segment->count = 0;
+    AddSegmentPoint(segment, b[0]);
+    TessellateCubic(segment, b[0], b[1], b[2], b[3], 0);
+
+    // Triangle strip, polyline points offset along the averaged normal of their lines
+    float size = thickness*0.5f;
+    Vector2 min = b[0];
+    Vector2 max = b[0];
+
+    for (int i = 0; i < segment->count; i++)
+    {
+        Vector2 previous = segment->points[(i > 0)? i - 1 : i];
+        Vector2 next = segment->points[(i < segment->count - 1)? i + 1 : i];
+        float dx = next.x - previous.x;
+        float dy = next.y - previous.y;
+        float length = sqrtf(dx*dx + dy*dy);
+
+        if (length > 0.0f)
+        {
+            dx /= length;
+            dy /= length;
+        }
+
+        Vector2 current = segment->points[i];
+        // Same sides order as DrawSplineSegment*() strips, so triangles keep the winding drawn with back-face culling
+        segment->strip[2*i] = (Vector2){ current.x + dy*size, current.y - dx*size };
+        segment->strip[2*i + 1] = (Vector2){ current.x - dy*size, current.y + dx*size };
+
+        if (current.x < min.x) min.x = current.x;
+        if (current.y < min.y) min.y = current.y;
+        if (current.x > max.x) max.x = current.x;
+        if (current.y > max.y) max.y = current.y;
+    }
+
+    segment->bounds = (Rectangle){ min.x - size, min.y - size, max.x - min.x + thickness, max.y - min.y + thickness };
+    segment->dirty = false;
+}
+
+// Update the spline cache, only the invalidated segments are tessellated
+// NOTE: Changing the spline type or thickness invalidates all the segments
+static void UpdateSplineCache(SplineCache *cache, const Vector2 *points, const ControlPoint *control, int pointCount, int type, float thickness)
+{
+    int segmentCount = 0;
+    if ((type == SPLINE_BASIS) || (type == SPLINE_CATMULLROM)) segmentCount = (pointCount > 3)? pointCount - 3 : 0;
+    else segmentCount = (pointCount > 1)? pointCount - 1 : 0;
+
+    bool invalidateAll = (type != cache->type) || (thickness != cache->thickness);
+    for (int i = 0; i < segmentCount; i++)
+    {
+        if (invalidateAll || (i >= cache->segmentCount)) cache->segments[i].dirty = true;
+    }
+
+    cache->type = type;
+    cache->thickness = thickness;
+    cache->segmentCount = segmentCount;
+    cache->tessellated = 0;
+
+    for (int i = 0; i < segmentCount; i++)
+    {
+        if (cache->segments[i].dirty)
+        {
+            TessellateSplineSegment(&cache->segments[i], points, control, i, type, thickness);
+            cache->tessellated++;
+        }
+    }
+
+    // Arc length at the start of every segment, a prefix sum of the segment lengths
+    if (cache->tessellated > 0)
+    {
+        cache->segmentStart[0] = 0.0f;
+        for (int i = 0; i < segmentCount; i++)
+        {
+            const SplineSegment *segment = &cache->segments[i];
+            cache->segmentStart[i + 1] = cache->segmentStart[i] + segment->lengths[segment->count - 1];
+        }
+    }
+    else if (segmentCount == 0) cache->segmentStart[0] = 0.0f;
+}
+
+// Draw the cached triangle strips of the segments overlapping the view
+// NOTE: Linear and Bezier segments can meet at an angle, their joints are rounded
+static void DrawSplineCache(const SplineCache *cache, Rectangle view, Color color)
+{
+    bool roundJoints = (cache->type == SPLINE_LINEAR) || (cache->type == SPLINE_BEZIER);
+
+    for (int i = 0; i < cache->segmentCount; i++)
+    {
+        const SplineSegment *segment = &cache->segments[i];
+        if (!CheckCollisionRecs(segment->bounds, view)) continue;
+
+        DrawTriangleStrip(segment->strip, 2*segment->count, color);
+        if (roundJoints && (i > 0)) DrawCircleV(segment->points[0], cache->thickness*0.5f, color);
+    }
+}
+
+// Get the spline point at an arc length distance from its start, used to sample the spline at constant speed
+// NOTE: Binary search of the segment in the segments prefix sum, then of the line in the segment arc length table
+static Vector2 GetSplineCachePoint(const SplineCache *cache, float distance)
+{
+    if (cache->segmentCount == 0) return (Vector2){ 0 };
+
+    int low = 0;
+    int high = cache->segmentCount - 1;
+    while (low < high)
+    {
+        int middle = (low + high + 1)/2;
+        if (cache->segmentStart[middle] <= distance) low = middle;
+        else high = middle - 1;
+    }
+
+    const SplineSegment *segment = &cache->segments[low];
+    float local = distance - cache->segmentStart[low];
+
+    int first = 0;
+    int last = segment->count - 1;
+    while ((last - first) > 1)
+    {
+        int middle = (first + last)/2;
+        if (segment->lengths[middle] <= local) first = middle;
+        else last = middle;
+    }
+
+    float lineLength = segment->lengths[last] - segment->lengths[first];
+    float t = (lineLength > 0.0f)? (local - segment->lengths[first])/lineLength : 0.0f;
+    if (t < 0.0f) t = 0.0f;
+    else if (t > 1.0f) t = 1.0f;
+
+    Vector2 a = segment->points[first];
+    Vector2 b = segment->points[last];
+
+    return (Vector2){ a.x + (b.x - a.x)*t, a.y + (b.y - a.y)*t };
+}
@@ -19,14 +19,24 @@
 #include "raymath.h"
 #include "rlgl.h"
 
+#include <stdlib.h>         // Required for: calloc(), realloc(), free()
+#include <math.h>           // Required for: cosf(), sinf(), floorf(), fabsf(), ceilf()
+
 // Custom Blend Modes
 #define RLGL_SRC_ALPHA  0x0302
 #define RLGL_MIN        0x8007
 #define RLGL_MAX        0x8008
 
-#define MAX_BOXES       20
-#define MAX_SHADOWS     MAX_BOXES*3     // MAX_BOXES*3 - Each box can cast up to two shadow volumes for the edges it is away from, and one for the box itself
-#define MAX_LIGHTS      16
+#define MAX_BOXES       20000   // Each box can cast up to two shadow volumes for the edges it is away from, and one for the box itself
+#define MAX_LIGHTS      48
+
+#define BOXES_PER_ADD   500     // Boxes added at once
+#define MOVING_BOX_RATIO 10     // One of every MOVING_BOX_RATIO added boxes moves
+#define GRID_CELL_SIZE  50      // Boxes grid cell size (pixels)
+
+#define ATLAS_WIDTH     2048    // Light masks atlas width, the height grows with the lights
+#define ATLAS_MAX_HEIGHT 4096
+#define ATLAS_PADDING   2       // Space between light masks, avoids bilinear filtering bleeding
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -43,19 +53,48 @@ typedef struct LightInfo {
     bool valid;                 // Is this light in a valid position?
 
     Vector2 position;           // Light position
-    RenderTexture mask;         // Alpha mask for the light
+    Rectangle region;           // Alpha mask for the light, area in the light masks atlas
     float outerRadius;          // The distance the light touches
     Rectangle bounds;           // A cached rectangle of the light bounds to help with culling
 
-    ShadowGeometry shadows[MAX_SHADOWS];
+    Vector2 anchor;             // Orbit center of a moving light
+    float orbitAngle;           // Current angle around the orbit center
+
+    ShadowGeometry *shadows;    // Shadow volumes cast by the boxes in the light bounds, grows as needed
     int shadowCount;
+    int shadowCapacity;
 } LightInfo;
 
+// Boxes grid, finds the boxes overlapping an area without visiting all of them
+// NOTE: Boxes are listed in every cell they overlap, sorted by cell with a counting sort,
+// the boxes of a cell are cellBoxes[cellStart[cell]] to cellBoxes[cellStart[cell + 1] - 1]
+typedef struct BoxGrid {
+    int columns;
+    int rows;
+    int *cellStart;             // First entry of every cell, columns*rows + 1 entries
+    int *cellBoxes;             // Box index of every entry
+    int entryCapacity;
+    int *boxQuery;              // Last query that found every box, a box overlapping many cells is reported once
+    int *results;               // Boxes found by the last query
+    int query;
+} BoxGrid;
+
 //------------------------------------------------------------------------------------
 // Global Variables Definition
 //------------------------------------------------------------------------------------
 static LightInfo lights[MAX_LIGHTS] = { 0 };
 
+static BoxGrid grid = { 0 };
+
+// Light masks of all the lights, every light only uses the area its radius covers
+static RenderTexture lightAtlas = { 0 };
+static int atlasScale = 2;          // Light masks downsampling: 1, 2 or 4
+static bool atlasChanged = false;   // Light masks were repacked, the lights must be merged again
+
+// Shadow updates stats of the last frame
+static int shadowVolumesBuilt = 0;
+static int boxesTested = 0;
+
 //------------------------------------------------------------------------------------
 // Module Functions Declaration
 //------------------------------------------------------------------------------------
@@ -67,10 +106,20 @@ static void ComputeShadowVolumeForEdge(int slot, Vector2 sp, Vector2 ep);
 static void DrawLightMask(int slot);
 // Setup a light
 static void SetupLight(int slot, float x, float y, float radius);
+// Pack the masks of the active lights in the atlas and draw them
+static void PackLightAtlas(void);
 // See if a light needs to update it's mask
-static bool UpdateLight(int slot, Rectangle* boxes, int count);
+static bool UpdateLight(int slot, Rectangle* boxes);
+// Mark as dirty the lights touched by an area, a box moved from or to it
+static void MarkLightsDirty(Rectangle area);
 // Set up some boxes
-static void SetupBoxes(Rectangle *boxes, int *count);
+static void SetupBoxes(Rectangle *boxes, Vector2 *speeds, int *count);
+// Add random boxes, some of them moving
+static void AddBoxes(Rectangle *boxes, Vector2 *speeds, int *count, int add);
+// Sort the boxes in the grid cells
+static void UpdateBoxGrid(Rectangle *boxes, int count);
+// Find the boxes overlapping an area, returns the number of boxes in grid.results
+static int QueryBoxGrid(Rectangle area);
 
 //------------------------------------------------------------------------------------
 // Program main entry point
@@ -84,10 +133,19 @@ int main(void)
 
     InitWindow(screenWidth, screenHeight, "raylib [shapes] example - top down lights");
 
-    // Initialize our 'world' of boxes
+    // Initialize our 'world' of boxes, boxes with speed move around the screen
     int boxCount = 0;
-    Rectangle boxes[MAX_BOXES] = { 0 };
-    SetupBoxes(boxes, &boxCount);
+    Rectangle *boxes = (Rectangle *)RL_CALLOC(MAX_BOXES, sizeof(Rectangle));
+    Vector2 *boxSpeeds = (Vector2 *)RL_CALLOC(MAX_BOXES, sizeof(Vector2));
+    SetupBoxes(boxes, boxSpeeds, &boxCount);
+
+    // Boxes grid over the screen, boxes out of the screen are in the border cells
+    grid.columns = (screenWidth + GRID_CELL_SIZE - 1)/GRID_CELL_SIZE;
+    grid.rows = (screenHeight + GRID_CELL_SIZE - 1)/GRID_CELL_SIZE;
+    grid.cellStart = (int *)RL_CALLOC(grid.columns*grid.rows + 1, sizeof(int));
+    grid.boxQuery = (int *)RL_CALLOC(MAX_BOXES, sizeof(int));
+    grid.results = (int *)RL_CALLOC(MAX_BOXES, sizeof(int));
+    UpdateBoxGrid(boxes, boxCount);
 
     // Create a checkerboard ground texture
     Image img = GenImageChecked(64, 64, 32, 32, DARKBROWN, DARKGRAY);
@@ -102,6 +160,11 @@ int main(void)
     int nextLight = 1;
 
     bool showLines = false;
+    bool moveBoxes = false;
+    bool moveLights = false;
+
+    double shadowTime = 0.0;        // Time of the last frame boxes and shadows update (ms)
+    int updatedLights = 0;          // Lights with their shadows updated on the last frame
 
     SetTargetFPS(60);               // Set our game to run at 60 frames-per-second
     //--------------------------------------------------------------------------------------
@@ -121,16 +184,92 @@ int main(void)
             nextLight++;
         }
 
-        // Toggle debug info
+        // Make some new lights around the screen
+        if (IsKeyPressed(KEY_N))
+        {
+            for (int i = 0; (i < 8) && (nextLight < MAX_LIGHTS); i++, nextLight++)
+            {
+                SetupLight(nextLight, (float)GetRandomValue(0, screenWidth), (float)GetRandomValue(0, screenHeight), (float)GetRandomValue(80, 200));
+            }
+        }
+
+        // Add boxes, all of them are new occluders for the lights they touch
+        if (IsKeyPressed(KEY_B) && (boxCount < MAX_BOXES))
+        {
+            int first = boxCount;
+            AddBoxes(boxes, boxSpeeds, &boxCount, BOXES_PER_ADD);
+            for (int b = first; b < boxCount; b++) MarkLightsDirty(boxes[b]);
+            UpdateBoxGrid(boxes, boxCount);
+        }
+
+        // Toggle debug info and movement
         if (IsKeyPressed(KEY_F1)) showLines = !showLines;
+        if (IsKeyPressed(KEY_M)) moveBoxes = !moveBoxes;
+        if (IsKeyPressed(KEY_L)) moveLights = !moveLights;
+
+        // Change the light masks downsampling
+        if (IsKeyPressed(KEY_D))
+        {
+            atlasScale = (atlasScale >= 4)? 1 : atlasScale*2;
+            PackLightAtlas();
+        }
+
+        double shadowStartTime = GetTime();
+
+        // Move the lights around their orbit, light 0 is moved by the mouse
+        if (moveLights)
+        {
+            for (int i = 1; i < MAX_LIGHTS; i++)
+            {
+                if (!lights[i].active) continue;
+
+                lights[i].orbitAngle += ((i%2 == 0)? 1.0f : -1.0f)*GetFrameTime();
+                MoveLight(i, lights[i].anchor.x + 40.0f*cosf(lights[i].orbitAngle), lights[i].anchor.y + 40.0f*sinf(lights[i].orbitAngle));
+            }
+        }
+
+        // Move the moving boxes, only the lights touched by a moving box before or after the move update their shadows
+        if (moveBoxes)
+        {
+            bool boxesMoved = false;
+
+            for (int b = 0; b < boxCount; b++)
+            {
+                if ((boxSpeeds[b].x == 0.0f) && (boxSpeeds[b].y == 0.0f)) continue;
+
+                MarkLightsDirty(boxes[b]);
+
+                boxes[b].x += boxSpeeds[b].x*GetFrameTime();
+                boxes[b].y += boxSpeeds[b].y*GetFrameTime();
+                if (boxes[b].x < 0) boxSpeeds[b].x = fabsf(boxSpeeds[b].x);
+                else if ((boxes[b].x + boxes[b].width) > screenWidth) boxSpeeds[b].x = -fabsf(boxSpeeds[b].x);
+                if (boxes[b].y < 0) boxSpeeds[b].y = fabsf(boxSpeeds[b].y);
+                else if ((boxes[b].y + boxes[b].height) > screenHeight) boxSpeeds[b].y = -fabsf(boxSpeeds[b].y);
+
+                MarkLightsDirty(boxes[b]);
+                boxesMoved = true;
+            }
+
+            if (boxesMoved) UpdateBoxGrid(boxes, boxCount);
+        }
 
         // Update the lights and keep track if any were dirty so we know if we need to update the master light mask
-        bool dirtyLights = false;
+        bool dirtyLights = atlasChanged;
+        atlasChanged = false;
+        updatedLights = 0;
+        shadowVolumesBuilt = 0;
+        boxesTested = 0;
         for (int i = 0; i < MAX_LIGHTS; i++)
         {
-            if (UpdateLight(i, boxes, boxCount)) dirtyLights = true;
+            if (UpdateLight(i, boxes))
+            {
+                dirtyLights = true;
+                updatedLights++;
+            }
         }
 
+        shadowTime = (GetTime() - shadowStartTime)*1000.0;
+
         // Update the light mask
         if (dirtyLights)
         {
@@ -143,10 +282,18 @@ int main(void)
                 rlSetBlendFactors(RLGL_SRC_ALPHA, RLGL_SRC_ALPHA, RLGL_MIN);
                 rlSetBlendMode(BLEND_CUSTOM);
 
-                // Merge in all the light masks
+                // Merge in all the light masks, in a single batch from the atlas
+                // NOTE: Render textures are flipped, the source rectangle is taken from the bottom
                 for (int i = 0; i < MAX_LIGHTS; i++)
                 {
-                    if (lights[i].active) DrawTextureRec(lights[i].mask.texture, (Rectangle){ 0, 0, (float)GetScreenWidth(), -(float)GetScreenHeight() }, Vector2Zero(), WHITE);
+                    if (!lights[i].active) continue;
+
+                    Rectangle region = lights[i].region;
+                    Rectangle source = { region.x, lightAtlas.texture.height - region.y - region.height, region.width, -region.height };
+                    Rectangle dest = { lights[i].position.x - lights[i].outerRadius, lights[i].position.y - lights[i].outerRadius,
+                        region.width*atlasScale, region.height*atlasScale };
+
+                    DrawTexturePro(lightAtlas.texture, source, dest, Vector2Zero(), 0.0f, WHITE);
                 }
 
                 rlDrawRenderBatchActive();
@@ -182,13 +329,26 @@ int main(void)
                     DrawTriangleFan(lights[0].shadows[s].vertices, 4, DARKPURPLE);
                 }
 
-                for (int b = 0; b < boxCount; b++)
+                // Boxes found by the grid in the light 0 bounds
+                int found = QueryBoxGrid(lights[0].bounds);
+                for (int f = 0; f < found; f++)
                 {
-                    if (CheckCollisionRecs(boxes[b],lights[0].bounds)) DrawRectangleRec(boxes[b], PURPLE);
+                    Rectangle box = boxes[grid.results[f]];
+                    if (CheckCollisionRecs(box, lights[0].bounds)) DrawRectangleRec(box, PURPLE);
+                }
 
+                for (int b = 0; b < boxCount; b++)
+                {
                     DrawRectangleLines((int)boxes[b].x, (int)boxes[b].y, (int)boxes[b].width, (int)boxes[b].height, DARKBLUE);
                 }
 
+                // Light masks atlas thumbnail
+                float thumbHeight = 200.0f*lightAtlas.texture.height/lightAtlas.texture.width;
+                Rectangle thumb = { 10, screenHeight - thumbHeight - 10, 200, thumbHeight };
+                DrawRectangleRec(thumb, BLACK);
+                DrawTexturePro(lightAtlas.texture, (Rectangle){ 0, 0, (float)lightAtlas.texture.width, -(float)lightAtlas.texture.height }, thumb, Vector2Zero(), 0.0f, WHITE);
+                DrawRectangleLinesEx(thumb, 1, GREEN);
+
                 DrawText("(F1) Hide Shadow Volumes", 10, 50, 10, GREEN);
             }
             else
@@ -199,6 +359,22 @@ int main(void)
             DrawFPS(screenWidth - 80, 10);
             DrawText("Drag to move light #1", 10, 10, 10, DARKGREEN);
             DrawText("Right click to add new light", 10, 30, 10, DARKGREEN);
+            DrawText("(N) Add 8 lights, (B) Add boxes", 10, 70, 10, GREEN);
+            DrawText(TextFormat("(M) %s boxes, (L) %s lights", moveBoxes? "Stop" : "Move", moveLights? "Stop" : "Move"), 10, 90, 10, GREEN);
+            DrawText(TextFormat("(D) Light masks resolution: 1/%i", atlasScale), 10, 110, 10, GREEN);
+
+            // Shadows update cost, only the dirty lights rebuild their shadows
+            DrawRectangle(screenWidth - 230, 35, 220, 100, Fade(BLACK, 0.6f));
+            DrawText(TextFormat("Boxes: %i, lights: %i", boxCount, nextLight), screenWidth - 220, 45, 10, LIGHTGRAY);
+            DrawText(TextFormat("Updated lights: %i, volumes: %i", updatedLights, shadowVolumesBuilt), screenWidth - 220, 60, 10, LIGHTGRAY);
+            DrawText(TextFormat("Boxes tested: %i", boxesTested), screenWidth - 220, 75, 10, LIGHTGRAY);
+            DrawText(TextFormat("Shadows update: %.2f ms", shadowTime), screenWidth - 220, 90, 10, GREEN);
+
+            // Light masks memory, color and depth buffers of 4 bytes per pixel
+            // NOTE: A full screen render texture per light was used before the atlas
+            DrawText(TextFormat("Full screen masks: %.1f MB", nextLight*screenWidth*screenHeight*8/(1024.0f*1024.0f)), screenWidth - 220, 105, 10, LIGHTGRAY);
+            DrawText(TextFormat("Masks atlas %ix%i: %.1f MB", lightAtlas.texture.width, lightAtlas.texture.height,
+                lightAtlas.texture.width*lightAtlas.texture.height*8/(1024.0f*1024.0f)), screenWidth - 220, 120, 10, GREEN);
 
         EndDrawing();
         //----------------------------------------------------------------------------------
@@ -208,10 +384,15 @@ int main(void)
     //--------------------------------------------------------------------------------------
     UnloadTexture(backgroundTexture);
     UnloadRenderTexture(lightMask);
-    for (int i = 0; i < MAX_LIGHTS; i++)
-    {
-        if (lights[i].active) UnloadRenderTexture(lights[i].mask);
-    }
+    UnloadRenderTexture(lightAtlas);
+    for (int i = 0; i < MAX_LIGHTS; i++) RL_FREE(lights[i].shadows);
+
+    RL_FREE(boxes);
+    RL_FREE(boxSpeeds);
+    RL_FREE(grid.cellStart);
+    RL_FREE(grid.cellBoxes);
+    RL_FREE(grid.boxQuery);
+    RL_FREE(grid.results);
 
     CloseWindow();        // Close window and OpenGL context
     //--------------------------------------------------------------------------------------
@@ -234,11 +415,26 @@ static void MoveLight(int slot, float x, float y)
     lights[slot].bounds.y = y - lights[slot].outerRadius;
 }
 
+// Make room for one more shadow volume in the light, shadows array grows as needed
+static bool ReserveShadow(int slot)
+{
+    if (lights[slot].shadowCount < lights[slot].shadowCapacity) return true;
+
+    int capacity = (lights[slot].shadowCapacity == 0)? 64 : lights[slot].shadowCapacity*2;
+    ShadowGeometry *shadows = (ShadowGeometry *)RL_REALLOC(lights[slot].shadows, capacity*sizeof(ShadowGeometry));
+    if (shadows == NULL) return false;
+
+    lights[slot].shadows = shadows;
+    lights[slot].shadowCapacity = capacity;
+
+    return true;
+}
+
 // Compute a shadow volume for the edge
 // It takes the edge and projects it back by the light radius and turns it into a quad
 static void ComputeShadowVolumeForEdge(int slot, Vector2 sp, Vector2 ep)
 {
-    if (lights[slot].shadowCount >= MAX_SHADOWS) return;
+    if (!ReserveShadow(slot)) return;
 
     float extension = lights[slot].outerRadius*2;
 
@@ -254,6 +450,7 @@ static void ComputeShadowVolumeForEdge(int slot, Vector2 sp, Vector2 ep)
     lights[slot].shadows[lights[slot].shadowCount].vertices[3] = spProjection;
 
     lights[slot].shadowCount++;
+    shadowVolumesBuilt++;
 }
 
 // Setup a light
@@ -261,7 +458,8 @@ static void SetupLight(int slot, float x, float y, float radius)
 {
     lights[slot].active = true;
     lights[slot].valid = false;  // The light must prove it is valid
-    lights[slot].mask = LoadRenderTexture(GetScreenWidth(), GetScreenHeight());
+    lights[slot].anchor = (Vector2){ x, y };
+    lights[slot].orbitAngle = 0.0f;
     lights[slot].outerRadius = radius;
 
     lights[slot].bounds.width = radius*2;
@@ -269,12 +467,89 @@ static void SetupLight(int slot, float x, float y, float radius)
 
     MoveLight(slot, x, y);
 
-    // Force the render texture to have something in it
-    DrawLightMask(slot);
+    // Make room for the new light mask, it also forces it to have something in it
+    PackLightAtlas();
+}
+
+// Pack the masks of the active lights in the atlas and draw them
+// NOTE: Lights are sorted by radius and placed in rows as tall as their first light,
+// if they don't fit in the atlas the downsampling is increased until they do
+static void PackLightAtlas(void)
+{
+    int order[MAX_LIGHTS] = { 0 };
+    int count = 0;
+
+    for (int i = 0; i < MAX_LIGHTS; i++)
+    {
+        if (lights[i].active) order[count++] = i;
+    }
+
+    // Sort the lights by radius, largest first
+    for (int i = 1; i < count; i++)
+    {
+        int light = order[i];
+        int j = i - 1;
+
+        for (; (j >= 0) && (lights[order[j]].outerRadius < lights[light].outerRadius); j--) order[j + 1] = order[j];
+        order[j + 1] = light;
+    }
+
+    int height = 0;
+
+    while (true)
+    {
+        int x = 0;
+        int y = 0;
+        int rowHeight = 0;
+
+        for (int i = 0; i < count; i++)
+        {
+            int size = (int)ceilf(lights[order[i]].outerRadius*2.0f/atlasScale);
+
+            // Start a new row when the light does not fit in the current one
+            if ((x + size) > ATLAS_WIDTH)
+            {
+                x = 0;
+                y += rowHeight + ATLAS_PADDING;
+                rowHeight = 0;
+            }
+
+            lights[order[i]].region = (Rectangle){ (float)x, (float)y, (float)size, (float)size };
+            x += size + ATLAS_PADDING;
+            if (size > rowHeight) rowHeight = size;
+        }
+
+        height = y + rowHeight;
+        if ((height <= ATLAS_MAX_HEIGHT) || (atlasScale >= 4)) break;
+
+        atlasScale *= 2;
+        TraceLog(LOG_INFO, "LIGHTS: Light masks do not fit in the atlas, downsampling them to 1/%i", atlasScale);
+    }
+
+    // Grow the atlas in steps, not on every new light
+    height = ((height + 255)/256)*256;
+    if (height < 256) height = 256;
+
+    if (lightAtlas.texture.height != height)
+    {
+        if (lightAtlas.id > 0) UnloadRenderTexture(lightAtlas);
+        lightAtlas = LoadRenderTexture(ATLAS_WIDTH, height);
+        SetTextureFilter(lightAtlas.texture, TEXTURE_FILTER_BILINEAR);
+    }
+
+    // The space between the light masks is full shadow
+    BeginTextureMode(lightAtlas);
+        ClearBackground(WHITE);
+    EndTextureMode();
+
+    // Shadow volumes are kept, only the masks are drawn again
+    for (int i = 0; i < count; i++) DrawLightMask(order[i]);
+
+    atlasChanged = true;
 }
 
 // See if a light needs to update it's mask
-static bool UpdateLight(int slot, Rectangle* boxes, int count)
+static bool UpdateLight(int slot, Rectangle* boxes)
 {
     if (!lights[slot].active || !lights[slot].dirty) return false;
 
@@ -282,10 +557,21 @@ static bool UpdateLight(int slot, Rectangle* boxes, int count)
     lights[slot].shadowCount = 0;
     lights[slot].valid = false;
 
-    for (int i = 0; i < count; i++)
+    // Only the boxes in the grid cells of our bounds can cast shadows
+    int found = QueryBoxGrid(lights[slot].bounds);
+    boxesTested += found;
+
+    for (int f = 0; f < found; f++)
     {
-        // Are we in a box? if so we are not valid
-        if (CheckCollisionPointRec(lights[slot].position, boxes[i])) return false;
+        int i = grid.results[f];
+
+        // Are we in a box? if so we are not valid, the light mask is all shadow
+        if (CheckCollisionPointRec(lights[slot].position, boxes[i]))
+        {
+            lights[slot].shadowCount = 0;
+            DrawLightMask(slot);
+            return true;
+        }
 
         // If this box is outside our bounds, we can skip it
         if (!CheckCollisionRecs(lights[slot].bounds, boxes[i])) continue;
@@ -314,11 +600,13 @@ static bool UpdateLight(int slot, Rectangle* boxes, int count)
         if (lights[slot].position.x > ep.x) ComputeShadowVolumeForEdge(slot, sp, ep);
 
         // The box itself
+        if (!ReserveShadow(slot)) continue;
         lights[slot].shadows[lights[slot].shadowCount].vertices[0] = (Vector2){ boxes[i].x, boxes[i].y };
         lights[slot].shadows[lights[slot].shadowCount].vertices[1] = (Vector2){ boxes[i].x, boxes[i].y + boxes[i].height };
         lights[slot].shadows[lights[slot].shadowCount].vertices[2] = (Vector2){ boxes[i].x + boxes[i].width, boxes[i].y + boxes[i].height };
         lights[slot].shadows[lights[slot].shadowCount].vertices[3] = (Vector2){ boxes[i].x + boxes[i].width, boxes[i].y };
         lights[slot].shadowCount++;
+        shadowVolumesBuilt++;
     }
 
     lights[slot].valid = true;
@@ -331,10 +619,18 @@ static bool UpdateLight(int slot, Rectangle* boxes, int count)
 // Draw the light and shadows to the mask for a light
 static void DrawLightMask(int slot)
 {
-    // Use the light mask
-    BeginTextureMode(lights[slot].mask);
+    Rectangle region = lights[slot].region;
+    Vector2 origin = { lights[slot].position.x - lights[slot].outerRadius, lights[slot].position.y - lights[slot].outerRadius };
 
-        ClearBackground(WHITE);
+    // Use the light mask area of the atlas, the light bounds are mapped to it
+    BeginTextureMode(lightAtlas);
+    BeginScissorMode((int)region.x, (int)region.y, (int)region.width, (int)region.height);
+    rlPushMatrix();
+        rlTranslatef(region.x, region.y, 0.0f);
+        rlScalef(1.0f/atlasScale, 1.0f/atlasScale, 1.0f);
+        rlTranslatef(-origin.x, -origin.y, 0.0f);
+
+        ClearBackground(WHITE);     // Scissor limits the clear to the light mask area
 
         // Force the blend mode to only set the alpha of the destination
         rlSetBlendFactors(RLGL_SRC_ALPHA, RLGL_SRC_ALPHA, RLGL_MIN);
@@ -361,11 +657,22 @@ static void DrawLightMask(int slot)
         // Go back to normal blend mode
         rlSetBlendMode(BLEND_ALPHA);
 
+    rlPopMatrix();
+    EndScissorMode();
     EndTextureMode();
 }
 
+// Mark as dirty the lights touched by an area, a box moved from or to it
+static void MarkLightsDirty(Rectangle area)
+{
+    for (int i = 0; i < MAX_LIGHTS; i++)
+    {
+        if (lights[i].active && !lights[i].dirty && CheckCollisionRecs(lights[i].bounds, area)) lights[i].dirty = true;
+    }
+}
+
 // Set up some boxes
-static void SetupBoxes(Rectangle *boxes, int *count)
+static void SetupBoxes(Rectangle *boxes, Vector2 *speeds, int *count)
 {
     boxes[0] = (Rectangle){ 150,80, 40, 40 };
     boxes[1] = (Rectangle){ 1200, 700, 40, 40 };
@@ -373,10 +680,104 @@ static void SetupBoxes(Rectangle *boxes, int *count)
     boxes[3] = (Rectangle){ 1000, 50, 40, 40 };
     boxes[4] = (Rectangle){ 500, 350, 40, 40 };
 
-    for (int i = 5; i < MAX_BOXES; i++)
+    for (int i = 5; i < 20; i++)
     {
         boxes[i] = (Rectangle){(float)GetRandomValue(0,GetScreenWidth()), (float)GetRandomValue(0,GetScreenHeight()), (float)GetRandomValue(10,100), (float)GetRandomValue(10,100) };
     }
 
-    *count = MAX_BOXES;
+    // A few of the boxes move
+    for (int i = 0; i < 20; i++)
+    {
+        speeds[i] = (i%MOVING_BOX_RATIO == 0)? (Vector2){ (float)GetRandomValue(-60, 60), (float)GetRandomValue(-60, 60) } : (Vector2){ 0 };
+    }
+
+    *count = 20;
+}
+
+// Add random boxes, some of them moving
+// NOTE: Added boxes are smaller, thousands of them still leave room for the lights
+static void AddBoxes(Rectangle *boxes, Vector2 *speeds, int *count, int add)
+{
+    for (int i = 0; (i < add) && (*count < MAX_BOXES); i++, (*count)++)
+    {
+        boxes[*count] = (Rectangle){ (float)GetRandomValue(0, GetScreenWidth()), (float)GetRandomValue(0, GetScreenHeight()), (float)GetRandomValue(4, 12), (float)GetRandomValue(4, 12) };
+        speeds[*count] = (i%MOVING_BOX_RATIO == 0)? (Vector2){ (float)GetRandomValue(-60, 60), (float)GetRandomValue(-60, 60) } : (Vector2){ 0 };
+    }
+}
+
+// Range of grid cells overlapped by an area, areas out of the screen are clamped to the border cells
+static void GetGridCells(Rectangle area, int *firstColumn, int *firstRow, int *lastColumn, int *lastRow)
+{
+    *firstColumn = (int)Clamp(floorf(area.x/GRID_CELL_SIZE), 0.0f, (float)(grid.columns - 1));
+    *lastColumn = (int)Clamp(floorf((area.x + area.width)/GRID_CELL_SIZE), 0.0f, (float)(grid.columns - 1));
+    *firstRow = (int)Clamp(floorf(area.y/GRID_CELL_SIZE), 0.0f, (float)(grid.rows - 1));
+    *lastRow = (int)Clamp(floorf((area.y + area.height)/GRID_CELL_SIZE), 0.0f, (float)(grid.rows - 1));
+}
+
+// Sort the boxes in the grid cells, counting sort over the cells every box overlaps
+static void UpdateBoxGrid(Rectangle *boxes, int count)
+{
+    int cellCount = grid.columns*grid.rows;
+    int firstColumn, firstRow, lastColumn, lastRow;
+
+    // Count the boxes of every cell
+    for (int cell = 0; cell <= cellCount; cell++) grid.cellStart[cell] = 0;
+    for (int b = 0; b < count; b++)
+    {
+        GetGridCells(boxes[b], &firstColumn, &firstRow, &lastColumn, &lastRow);
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int column = firstColumn; column <= lastColumn; column++) grid.cellStart[row*grid.columns + column + 1]++;
+        }
+    }
+
+    // Prefix sum, first entry of every cell
+    for (int cell = 0; cell < cellCount; cell++) grid.cellStart[cell + 1] += grid.cellStart[cell];
+
+    int entryCount = grid.cellStart[cellCount];
+    if (entryCount > grid.entryCapacity)
+    {
+        int *cellBoxes = (int *)RL_REALLOC(grid.cellBoxes, entryCount*2*sizeof(int));
+        if (cellBoxes == NULL) return;
+        grid.cellBoxes = cellBoxes;
+        grid.entryCapacity = entryCount*2;
+    }
+
+    // Place the boxes, cellStart is used as the insert position and shifted back one cell after
+    for (int b = 0; b < count; b++)
+    {
+        GetGridCells(boxes[b], &firstColumn, &firstRow, &lastColumn, &lastRow);
+        for (int row = firstRow; row <= lastRow; row++)
+        {
+            for (int column = firstColumn; column <= lastColumn; column++) grid.cellBoxes[grid.cellStart[row*grid.columns + column]++] = b;
+        }
+    }
+
+    for (int cell = cellCount; cell > 0; cell--) grid.cellStart[cell] = grid.cellStart[cell - 1];
+    grid.cellStart[0] = 0;
+}
+
+// Find the boxes overlapping an area, returns the number of boxes in grid.results
+// NOTE: Boxes in the cells of the area are returned, they can still be out of the area itself
+static int QueryBoxGrid(Rectangle area)
+{
+    int firstColumn, firstRow, lastColumn, lastRow;
+    int found = 0;
+
+    GetGridCells(area, &firstColumn, &firstRow, &lastColumn, &lastRow);
+    grid.query++;
+
+    for (int row = firstRow; row <= lastRow; row++)
+    {
+        for (int e = grid.cellStart[row*grid.columns + firstColumn]; e < grid.cellStart[row*grid.columns + lastColumn + 1]; e++)
+        {
+            int b = grid.cellBoxes[e];
+            if (grid.boxQuery[b] == grid.query) continue;
+
+            grid.boxQuery[b] = grid.query;
+            grid.results[found++] = b;
+        }
+    }
+
+    return found;
 }